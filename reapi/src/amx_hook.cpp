@@ -1,10 +1,14 @@
 #include "precompiled.h"
 
-CAmxxHookBase::CAmxxHookBase(AMX *amx, const char *funcname, int forwardIndex, int index) :
+CAmxxHookBase::CAmxxHookBase(AMX *amx, const char *funcname, int forwardIndex, int index, int funcIndex, int flags) :
 	m_fwdindex(forwardIndex),
 	m_index(index),
+	m_funcindex(funcIndex),
+	m_flags(flags),
 	m_state(FSTATE_ENABLED),
-	m_amx(amx)
+	m_amx(amx),
+	m_numEvents(0),
+	m_stride(0)
 {
 	Q_strlcpy(m_CallbackName, funcname);
 }
@@ -36,3 +40,60 @@ void CAmxxHookBase::Error(int error, const char *fmt, ...)
 	g_amxxapi.Log("Run time error %d (plugin \"%s\") (forward \"%s\")", error, scriptName, m_CallbackName);
 	g_amxxapi.Log("%s", string);
 }
+
+bool CAmxxHookBase::PushEvent(const cell *args, size_t count)
+{
+	m_stride = count;
+	m_events.insert(m_events.end(), args, args + count);
+	return m_numEvents++ == 0;
+}
+
+bool CAmxxHookBase::DispatchEvents()
+{
+	// handlers may queue new events, they are kept for the next dispatch
+	const size_t total = m_numEvents;
+	m_dispatching.swap(m_events);
+	m_numEvents = 0;
+
+	size_t dispatched = total;
+
+	if (m_state == FSTATE_ENABLED && total > 0)
+	{
+		// hooks without arguments still need a valid array
+		if (m_dispatching.empty())
+			m_dispatching.push_back(0);
+
+		dispatched = 0;
+		while (dispatched < total)
+		{
+			size_t count = total - dispatched;
+			if (m_stride)
+			{
+				// the array is copied to the plugin heap, half of the free space is left to the handler
+				const size_t freeCells = (m_amx->stk - m_amx->hea) / sizeof(cell) / 2;
+				count = min(count, min<size_t>(MAX_DEFERRED_CELLS, freeCells) / m_stride);
+
+				if (!count)
+				{
+					Error(AMX_ERR_MEMORY, "Not enough heap for deferred events of %u cells, %u events are kept for the next frame", m_stride, total - dispatched);
+					break;
+				}
+			}
+
+			g_amxxapi.ExecuteForward(m_fwdindex, g_amxxapi.PrepareCellArrayA(&m_dispatching[dispatched * m_stride], max(count * m_stride, 1u), false), count, m_stride);
+			dispatched += count;
+		}
+	}
+
+	bool requeue = false;
+	if (dispatched < total)
+	{
+		// ahead of the events queued by the handlers, which have queued the forward already
+		requeue = (m_numEvents == 0);
+		m_events.insert(m_events.begin(), m_dispatching.begin() + dispatched * m_stride, m_dispatching.begin() + total * m_stride);
+		m_numEvents += total - dispatched;
+	}
+
+	m_dispatching.clear();
+	return requeue;
+}
@@ -8,24 +8,76 @@ enum fwdstate
 	FSTATE_STOPPED
 };
 
+// hookchain registration flags
+enum hookflags
+{
+	HOOKFLAG_NONE        = 0,
+	HOOKFLAG_DIRECT_EXEC = BIT(0), // call the public through amx_Exec, bypassing ExecuteForward
+	HOOKFLAG_DEFERRED    = BIT(1), // post only, queue the args and deliver them in a batch on the next frame
+};
+
+// max cells of queued events passed to a deferred forward in one call,
+// less if the free space of the plugin heap is short
+#define MAX_DEFERRED_CELLS 512
+
+// User-provided data to be passed to a callback function, copied with a trailing zero cell
+class CAmxxUserParams
+{
+public:
+	void Set(const cell *pParams, size_t iParamsLen)
+	{
+		m_params.clear();
+
+		if (iParamsLen > 0)
+		{
+			m_params.assign(pParams, pParams + iParamsLen);
+			m_params.push_back(0);
+		}
+	}
+
+	void Clear()          { m_params.clear(); }
+
+	bool IsEmpty()  const { return m_params.empty(); }
+	cell *GetData()       { return m_params.data(); }
+	size_t GetSize() const { return m_params.size(); }
+
+private:
+	std::vector<cell> m_params;
+};
+
 class CAmxxHookBase
 {
 public:
 	~CAmxxHookBase();
-	CAmxxHookBase(AMX *amx, const char *funcname, int forwardIndex, int index);
+	CAmxxHookBase(AMX *amx, const char *funcname, int forwardIndex, int index, int funcIndex = -1, int flags = HOOKFLAG_NONE);
 
 	int GetFwdIndex()             const { return m_fwdindex; }
 	int GetIndex()                const { return m_index; }
 	fwdstate GetState()           const { return m_state; }
 	AMX *GetAmx()                 const { return m_amx; }
 	const char *GetCallbackName() const { return m_CallbackName; }
+	int GetFuncIndex()            const { return m_funcindex; }
+	bool IsDirectExec()           const { return (m_flags & HOOKFLAG_DIRECT_EXEC) != 0; }
+	bool IsDeferred()             const { return (m_flags & HOOKFLAG_DEFERRED) != 0; }
 
 	void SetState(fwdstate st) { m_state = st; }
 	void Error(int error, const char *fmt, ...);
 
+	// deferred forwards, returns true if it's the first event since the last dispatch
+	bool PushEvent(const cell *args, size_t count);
+
+	// Returns true if events are left for the next dispatch and the forward must be queued again
+	bool DispatchEvents();
+
 private:
 	int m_fwdindex, m_index;
+	int m_funcindex; // public index for direct amx_Exec
+	int m_flags;
 	char m_CallbackName[64];
 	fwdstate m_state;
 	AMX *m_amx;
+
+	std::vector<cell> m_events, m_dispatching;
+	size_t m_numEvents;
+	size_t m_stride; // cells per event
 };
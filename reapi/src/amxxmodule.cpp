@@ -40,7 +40,7 @@ static struct funcreq_t
 	DECLARE_REQ(AddNatives),
 	//DECLARE_REQ(AddNewNatives),
 	//DECLARE_REQ(BuildPathname),
-	//DECLARE_REQ(BuildPathnameR),
+	DECLARE_REQ(BuildPathnameR),
 	DECLARE_REQ(GetAmxAddr),
 	//DECLARE_REQ(GetAmxVectorNull),			// AMXX 1.8.3-dev
 	//DECLARE_REQ(PrintSrvConsole),
@@ -86,7 +86,7 @@ static struct funcreq_t
 	//DECLARE_REQ(IsPlayerHLTV),
 	//DECLARE_REQ(GetPlayerArmor),
 	//DECLARE_REQ(GetPlayerHealth),
-	//DECLARE_REQ(amx_Exec),
+	DECLARE_REQ(amx_Exec),
 	//DECLARE_REQ(amx_Execv),
 	//DECLARE_REQ(amx_Allot),
 	DECLARE_REQ(amx_FindPublic),
@@ -104,7 +104,7 @@ static struct funcreq_t
 	//DECLARE_REQ(Format),
 	//DECLARE_REQ(RegisterFunction),
 	//DECLARE_REQ(RequestFunction),
-	//DECLARE_REQ(amx_Push),
+	DECLARE_REQ(amx_Push),
 	DECLARE_REQ(SetPlayerTeamInfo),
 	//DECLARE_REQ(PlayerPropAddr),
 	//DECLARE_REQ(RegAuthFunc),
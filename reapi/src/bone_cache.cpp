@@ -0,0 +1,630 @@
+#include "precompiled.h"
+
+CBoneCache g_boneCache;
+
+// scratch buffers of the skeleton setup
+static vec4_t s_q[MAXSTUDIOBONES], s_q2[MAXSTUDIOBONES], s_q3[MAXSTUDIOBONES];
+static vec3_t s_pos[MAXSTUDIOBONES], s_pos2[MAXSTUDIOBONES], s_pos3[MAXSTUDIOBONES];
+
+static void AngleQuaternion(const vec3_t angles, vec4_t quaternion)
+{
+	float angle = angles[2] * 0.5f;
+	float sy = sin(angle);
+	float cy = cos(angle);
+
+	angle = angles[1] * 0.5f;
+	float sp = sin(angle);
+	float cp = cos(angle);
+
+	angle = angles[0] * 0.5f;
+	float sr = sin(angle);
+	float cr = cos(angle);
+
+	quaternion[0] = sr * cp * cy - cr * sp * sy; // X
+	quaternion[1] = cr * sp * cy + sr * cp * sy; // Y
+	quaternion[2] = cr * cp * sy - sr * sp * cy; // Z
+	quaternion[3] = cr * cp * cy + sr * sp * sy; // W
+}
+
+static void QuaternionSlerp(const vec4_t p, vec4_t q, float t, vec4_t qt)
+{
+	float a = 0.0f, b = 0.0f;
+
+	// decide if one of the quaternions is backwards
+	for (int i = 0; i < 4; i++)
+	{
+		a += (p[i] - q[i]) * (p[i] - q[i]);
+		b += (p[i] + q[i]) * (p[i] + q[i]);
+	}
+
+	if (a > b)
+	{
+		for (int i = 0; i < 4; i++)
+			q[i] = -q[i];
+	}
+
+	float sclp, sclq;
+	float cosom = p[0] * q[0] + p[1] * q[1] + p[2] * q[2] + p[3] * q[3];
+
+	if ((1.0f + cosom) > 0.000001f)
+	{
+		if ((1.0f - cosom) > 0.000001f)
+		{
+			float omega = acos(cosom);
+			float sinom = sin(omega);
+			sclp = sin((1.0f - t) * omega) / sinom;
+			sclq = sin(t * omega) / sinom;
+		}
+		else
+		{
+			sclp = 1.0f - t;
+			sclq = t;
+		}
+
+		for (int i = 0; i < 4; i++)
+			qt[i] = sclp * p[i] + sclq * q[i];
+	}
+	else
+	{
+		qt[0] = -q[1];
+		qt[1] = q[0];
+		qt[2] = -q[3];
+		qt[3] = q[2];
+
+		sclp = sin((1.0f - t) * (0.5f * M_PI));
+		sclq = sin(t * (0.5f * M_PI));
+
+		for (int i = 0; i < 3; i++)
+			qt[i] = sclp * p[i] + sclq * qt[i];
+	}
+}
+
+static void QuaternionMatrix(const vec4_t q, bonematrix_t matrix)
+{
+	matrix[0][0] = 1.0f - 2.0f * q[1] * q[1] - 2.0f * q[2] * q[2];
+	matrix[1][0] = 2.0f * q[0] * q[1] + 2.0f * q[3] * q[2];
+	matrix[2][0] = 2.0f * q[0] * q[2] - 2.0f * q[3] * q[1];
+
+	matrix[0][1] = 2.0f * q[0] * q[1] - 2.0f * q[3] * q[2];
+	matrix[1][1] = 1.0f - 2.0f * q[0] * q[0] - 2.0f * q[2] * q[2];
+	matrix[2][1] = 2.0f * q[1] * q[2] + 2.0f * q[3] * q[0];
+
+	matrix[0][2] = 2.0f * q[0] * q[2] + 2.0f * q[3] * q[1];
+	matrix[1][2] = 2.0f * q[1] * q[2] - 2.0f * q[3] * q[0];
+	matrix[2][2] = 1.0f - 2.0f * q[0] * q[0] - 2.0f * q[1] * q[1];
+}
+
+static void AngleMatrix(const Vector &angles, bonematrix_t matrix)
+{
+	float angle = angles.y * (M_PI * 2 / 360);
+	float sy = sin(angle);
+	float cy = cos(angle);
+
+	angle = angles.x * (M_PI * 2 / 360);
+	float sp = sin(angle);
+	float cp = cos(angle);
+
+	angle = angles.z * (M_PI * 2 / 360);
+	float sr = sin(angle);
+	float cr = cos(angle);
+
+	// matrix = (YAW * PITCH) * ROLL
+	matrix[0][0] = cp * cy;
+	matrix[1][0] = cp * sy;
+	matrix[2][0] = -sp;
+
+	matrix[0][1] = sr * sp * cy + cr * -sy;
+	matrix[1][1] = sr * sp * sy + cr * cy;
+	matrix[2][1] = sr * cp;
+
+	matrix[0][2] = cr * sp * cy + -sr * -sy;
+	matrix[1][2] = cr * sp * sy + -sr * cy;
+	matrix[2][2] = cr * cp;
+
+	matrix[0][3] = 0.0f;
+	matrix[1][3] = 0.0f;
+	matrix[2][3] = 0.0f;
+}
+
+static void ConcatTransforms(const bonematrix_t in1, const bonematrix_t in2, bonematrix_t out)
+{
+	for (int i = 0; i < 3; i++)
+	{
+		out[i][0] = in1[i][0] * in2[0][0] + in1[i][1] * in2[1][0] + in1[i][2] * in2[2][0];
+		out[i][1] = in1[i][0] * in2[0][1] + in1[i][1] * in2[1][1] + in1[i][2] * in2[2][1];
+		out[i][2] = in1[i][0] * in2[0][2] + in1[i][1] * in2[1][2] + in1[i][2] * in2[2][2];
+		out[i][3] = in1[i][0] * in2[0][3] + in1[i][1] * in2[1][3] + in1[i][2] * in2[2][3] + in1[i][3];
+	}
+}
+
+static const mstudioanim_t *StudioGetAnim(const studiohdr_t *pstudiohdr, const mstudioseqdesc_t *pseqdesc)
+{
+	const mstudioseqgroup_t *pseqgroup = (const mstudioseqgroup_t *)((const byte *)pstudiohdr + pstudiohdr->seqgroupindex) + pseqdesc->seqgroup;
+	return (const mstudioanim_t *)((const byte *)pstudiohdr + pseqgroup->unused2 + pseqdesc->animindex);
+}
+
+// Walks the run-length encoded track up to the frame, returns the values of the frame and the next one
+static void StudioDecodeFrame(const mstudioanimvalue_t *panimvalue, int frame, float &value1, float &value2)
+{
+	int k = frame;
+
+	if (panimvalue->num.total < panimvalue->num.valid)
+		k = 0;
+
+	while (panimvalue->num.total <= k)
+	{
+		k -= panimvalue->num.total;
+		panimvalue += panimvalue->num.valid + 1;
+
+		if (panimvalue->num.total < panimvalue->num.valid)
+			k = 0;
+	}
+
+	if (panimvalue->num.valid > k)
+	{
+		value1 = panimvalue[k + 1].value;
+
+		if (panimvalue->num.valid > k + 1)
+			value2 = panimvalue[k + 2].value;
+		else if (panimvalue->num.total > k + 1)
+			value2 = value1;
+		else
+			value2 = panimvalue[panimvalue->num.valid + 2].value;
+	}
+	else
+	{
+		value1 = panimvalue[panimvalue->num.valid].value;
+
+		if (panimvalue->num.total > k + 1)
+			value2 = value1;
+		else
+			value2 = panimvalue[panimvalue->num.valid + 2].value;
+	}
+}
+
+static void StudioCalcBoneAdj(const studiohdr_t *pstudiohdr, float *adj, const byte *pcontroller)
+{
+	const mstudiobonecontroller_t *pbonecontroller = (const mstudiobonecontroller_t *)((const byte *)pstudiohdr + pstudiohdr->bonecontrollerindex);
+	const int numcontrollers = min(pstudiohdr->numbonecontrollers, MAXSTUDIOCONTROLLERS);
+
+	for (int j = 0; j < numcontrollers; j++)
+	{
+		float value;
+		int i = pbonecontroller[j].index;
+
+		if (i <= 3)
+		{
+			if (pbonecontroller[j].type & STUDIO_RLOOP)
+			{
+				value = pcontroller[i] * (360.0f / 256.0f) + pbonecontroller[j].start;
+			}
+			else
+			{
+				value = clamp(pcontroller[i] / 255.0f, 0.0f, 1.0f);
+				value = (1.0f - value) * pbonecontroller[j].start + value * pbonecontroller[j].end;
+			}
+		}
+		else
+		{
+			// mouth is never open on the server
+			value = pbonecontroller[j].start;
+		}
+
+		switch (pbonecontroller[j].type & STUDIO_TYPES)
+		{
+		case STUDIO_XR:
+		case STUDIO_YR:
+		case STUDIO_ZR:
+			adj[j] = value * (M_PI / 180.0);
+			break;
+		case STUDIO_X:
+		case STUDIO_Y:
+		case STUDIO_Z:
+			adj[j] = value;
+			break;
+		default:
+			adj[j] = 0.0f;
+			break;
+		}
+	}
+}
+
+static void StudioCalcBoneQuaternion(int frame, float s, const mstudiobone_t *pbone, const mstudioanim_t *panim, const float *adj, vec4_t q)
+{
+	vec3_t angle1, angle2;
+
+	for (int j = 0; j < 3; j++)
+	{
+		if (panim->offset[j + 3] == 0)
+		{
+			// default
+			angle2[j] = angle1[j] = pbone->value[j + 3];
+		}
+		else
+		{
+			StudioDecodeFrame((const mstudioanimvalue_t *)((const byte *)panim + panim->offset[j + 3]), frame, angle1[j], angle2[j]);
+			angle1[j] = pbone->value[j + 3] + angle1[j] * pbone->scale[j + 3];
+			angle2[j] = pbone->value[j + 3] + angle2[j] * pbone->scale[j + 3];
+		}
+
+		if (pbone->bonecontroller[j + 3] != -1)
+		{
+			angle1[j] += adj[pbone->bonecontroller[j + 3]];
+			angle2[j] += adj[pbone->bonecontroller[j + 3]];
+		}
+	}
+
+	if (angle1[0] != angle2[0] || angle1[1] != angle2[1] || angle1[2] != angle2[2])
+	{
+		vec4_t q1, q2;
+		AngleQuaternion(angle1, q1);
+		AngleQuaternion(angle2, q2);
+		QuaternionSlerp(q1, q2, s, q);
+	}
+	else
+	{
+		AngleQuaternion(angle1, q);
+	}
+}
+
+static void StudioCalcBonePosition(int frame, float s, const mstudiobone_t *pbone, const mstudioanim_t *panim, const float *adj, vec3_t pos)
+{
+	for (int j = 0; j < 3; j++)
+	{
+		// default
+		pos[j] = pbone->value[j];
+
+		if (panim->offset[j] != 0)
+		{
+			float value1, value2;
+			StudioDecodeFrame((const mstudioanimvalue_t *)((const byte *)panim + panim->offset[j]), frame, value1, value2);
+			pos[j] += (value1 * (1.0f - s) + s * value2) * pbone->scale[j];
+		}
+
+		if (pbone->bonecontroller[j] != -1)
+			pos[j] += adj[pbone->bonecontroller[j]];
+	}
+}
+
+static void StudioCalcRotations(const studiohdr_t *pstudiohdr, const mstudioanim_t *panim, float f, const float *adj, vec4_t *q, vec3_t *pos)
+{
+	const mstudiobone_t *pbone = (const mstudiobone_t *)((const byte *)pstudiohdr + pstudiohdr->boneindex);
+
+	int frame = int(f);
+	float s = f - frame;
+
+	for (int i = 0; i < pstudiohdr->numbones; i++, pbone++, panim++)
+	{
+		StudioCalcBoneQuaternion(frame, s, pbone, panim, adj, q[i]);
+		StudioCalcBonePosition(frame, s, pbone, panim, adj, pos[i]);
+	}
+}
+
+static void StudioSlerpBones(int numbones, vec4_t *q1, vec3_t *pos1, vec4_t *q2, const vec3_t *pos2, float s)
+{
+	s = clamp(s, 0.0f, 1.0f);
+	float s1 = 1.0f - s;
+
+	for (int i = 0; i < numbones; i++)
+	{
+		vec4_t q3;
+		QuaternionSlerp(q1[i], q2[i], s, q3);
+
+		q1[i][0] = q3[0];
+		q1[i][1] = q3[1];
+		q1[i][2] = q3[2];
+		q1[i][3] = q3[3];
+
+		pos1[i][0] = pos1[i][0] * s1 + pos2[i][0] * s;
+		pos1[i][1] = pos1[i][1] * s1 + pos2[i][1] * s;
+		pos1[i][2] = pos1[i][2] * s1 + pos2[i][2] * s;
+	}
+}
+
+// Same as StudioFrameAdvanceEnt, but doesn't touch the entity
+static float StudioCurrentFrame(const mstudioseqdesc_t *pseqdesc, const edict_t *pEdict)
+{
+	float flFrame = pEdict->v.frame;
+	float flInterval = gpGlobals->time - pEdict->v.animtime;
+	if (flInterval <= 0.001f)
+		return flFrame;
+
+	if (pEdict->v.animtime == 0.0f)
+		flInterval = 0.0f;
+
+	float flFrameRate = 256.0f;
+	if (pseqdesc->numframes > 1)
+		flFrameRate = pseqdesc->fps * 256.0f / (pseqdesc->numframes - 1);
+
+	flFrame += flInterval * flFrameRate * pEdict->v.framerate;
+
+	if (flFrame < 0.0f || flFrame >= 256.0f)
+	{
+		// true if the sequence loops
+		if (pseqdesc->flags & STUDIO_LOOPING)
+			flFrame -= int(flFrame / 256.0f) * 256.0f;
+		else
+			flFrame = (flFrame < 0.0f) ? 0.0f : 255.0f;
+	}
+
+	return flFrame;
+}
+
+bool bonepose_t::operator==(const bonepose_t &other) const
+{
+	return pstudiohdr == other.pstudiohdr
+		&& sequence == other.sequence
+		&& frame == other.frame
+		&& origin == other.origin
+		&& angles == other.angles
+		&& *(uint32 *)controller == *(uint32 *)other.controller
+		&& blending[0] == other.blending[0]
+		&& blending[1] == other.blending[1]
+		&& gaitsequence == other.gaitsequence
+		&& gaitframe == other.gaitframe;
+}
+
+bool CBoneCache::GetPose(CBaseEntity *pEntity, bonepose_t &pose)
+{
+	edict_t *pEdict = pEntity->edict();
+
+	studiohdr_t *pstudiohdr = static_cast<studiohdr_t *>(GET_MODEL_PTR(pEdict));
+	if (!pstudiohdr || pstudiohdr->numbones <= 0 || pstudiohdr->numbones > MAXSTUDIOBONES)
+		return false;
+
+	int sequence = pEdict->v.sequence;
+	if (sequence < 0 || sequence >= pstudiohdr->numseq)
+		sequence = 0;
+
+	const mstudioseqdesc_t *pseqdesc = (const mstudioseqdesc_t *)((const byte *)pstudiohdr + pstudiohdr->seqindex) + sequence;
+
+	// demand loaded animations are only reachable through the engine cache
+	if (pseqdesc->seqgroup != 0)
+		return false;
+
+	pose.pstudiohdr = pstudiohdr;
+	pose.sequence = sequence;
+	pose.frame = StudioCurrentFrame(pseqdesc, pEdict);
+	pose.origin = pEdict->v.origin;
+	pose.angles = pEdict->v.angles;
+	pose.angles.x = -pose.angles.x;
+	memcpy(pose.controller, pEdict->v.controller, sizeof(pose.controller));
+	memcpy(pose.blending, pEdict->v.blending, sizeof(pose.blending));
+	pose.gaitsequence = 0;
+	pose.gaitframe = 0.0f;
+
+	if (pEntity->IsPlayer())
+	{
+		// the legs are played by the gait sequence, the body is turned to the gait yaw
+		// and the aim direction is expressed by the blending and the bone controllers
+		CBasePlayer *pPlayer = static_cast<CBasePlayer *>(pEntity);
+		int gaitsequence = pPlayer->m_iGaitsequence;
+
+		if (gaitsequence > 0 && gaitsequence < pstudiohdr->numseq)
+		{
+			const mstudioseqdesc_t *pgaitdesc = (const mstudioseqdesc_t *)((const byte *)pstudiohdr + pstudiohdr->seqindex) + gaitsequence;
+			if (pgaitdesc->seqgroup != 0)
+				return false;
+
+			pose.gaitsequence = gaitsequence;
+			pose.gaitframe = clamp(pPlayer->m_flGaitframe, 0.0f, float(max(pgaitdesc->numframes - 1, 0)));
+			pose.angles = Vector(0, pPlayer->m_flGaityaw, 0);
+		}
+	}
+
+	return true;
+}
+
+void CBoneCache::SetupBones(bonecache_t *pCache)
+{
+	const bonepose_t &pose = pCache->pose;
+	const studiohdr_t *pstudiohdr = pose.pstudiohdr;
+	const mstudiobone_t *pbones = (const mstudiobone_t *)((const byte *)pstudiohdr + pstudiohdr->boneindex);
+	const mstudioseqdesc_t *pseqdesc = (const mstudioseqdesc_t *)((const byte *)pstudiohdr + pstudiohdr->seqindex) + pose.sequence;
+	const mstudioanim_t *panim = StudioGetAnim(pstudiohdr, pseqdesc);
+
+	const int numbones = pstudiohdr->numbones;
+
+	float adj[MAXSTUDIOCONTROLLERS];
+	StudioCalcBoneAdj(pstudiohdr, adj, pose.controller);
+
+	float f = (pseqdesc->numframes > 1) ? (pseqdesc->numframes - 1) * pose.frame / 256.0f : 0.0f;
+
+	if (pseqdesc->numblends == 4 || pseqdesc->numblends == 9)
+	{
+		// the blends form a 2x2 or 3x3 grid, blending[0] goes along a row and blending[1] along a column
+		int columns = 2, first = 0;
+		float s = pose.blending[0], t = pose.blending[1];
+
+		if (pseqdesc->numblends == 9)
+		{
+			// each half of the range covers one cell of the 3x3 grid
+			columns = 3;
+
+			if (s <= 127.0f)
+				s = s * 2.0f;
+			else
+			{
+				s = (s - 127.0f) * 2.0f;
+				first += 1;
+			}
+
+			if (t <= 127.0f)
+				t = t * 2.0f;
+			else
+			{
+				t = (t - 127.0f) * 2.0f;
+				first += columns;
+			}
+		}
+
+		StudioCalcRotations(pstudiohdr, panim + first * numbones, f, adj, s_q, s_pos);
+		StudioCalcRotations(pstudiohdr, panim + (first + 1) * numbones, f, adj, s_q2, s_pos2);
+		StudioSlerpBones(numbones, s_q, s_pos, s_q2, s_pos2, s / 255.0f);
+
+		StudioCalcRotations(pstudiohdr, panim + (first + columns) * numbones, f, adj, s_q2, s_pos2);
+		StudioCalcRotations(pstudiohdr, panim + (first + columns + 1) * numbones, f, adj, s_q3, s_pos3);
+		StudioSlerpBones(numbones, s_q2, s_pos2, s_q3, s_pos3, s / 255.0f);
+
+		StudioSlerpBones(numbones, s_q, s_pos, s_q2, s_pos2, t / 255.0f);
+	}
+	else
+	{
+		StudioCalcRotations(pstudiohdr, panim, f, adj, s_q, s_pos);
+
+		if (pseqdesc->numblends > 1)
+		{
+			StudioCalcRotations(pstudiohdr, panim + numbones, f, adj, s_q2, s_pos2);
+			StudioSlerpBones(numbones, s_q, s_pos, s_q2, s_pos2, pose.blending[0] / 255.0f);
+		}
+	}
+
+	if (pose.gaitsequence)
+	{
+		const mstudioseqdesc_t *pgaitdesc = (const mstudioseqdesc_t *)((const byte *)pstudiohdr + pstudiohdr->seqindex) + pose.gaitsequence;
+		StudioCalcRotations(pstudiohdr, StudioGetAnim(pstudiohdr, pgaitdesc), pose.gaitframe, adj, s_q2, s_pos2);
+
+		// the legs are taken from the gait sequence the way the game's player renderer does it:
+		// everything up to the spine, then again from each direct child of the pelvis on
+		bool copy = true;
+		for (int i = 0; i < numbones; i++)
+		{
+			if (!Q_strcmp(pbones[i].name, "Bip01 Spine"))
+				copy = false;
+			else if (pbones[i].parent >= 0 && !Q_strcmp(pbones[pbones[i].parent].name, "Bip01 Pelvis"))
+				copy = true;
+
+			if (copy)
+			{
+				memcpy(s_pos[i], s_pos2[i], sizeof(s_pos[i]));
+				memcpy(s_q[i], s_q2[i], sizeof(s_q[i]));
+			}
+		}
+	}
+
+	bonematrix_t rotationmatrix, bonematrix;
+	AngleMatrix(pose.angles, rotationmatrix);
+
+	rotationmatrix[0][3] = pose.origin.x;
+	rotationmatrix[1][3] = pose.origin.y;
+	rotationmatrix[2][3] = pose.origin.z;
+
+	for (int i = 0; i < numbones; i++)
+	{
+		QuaternionMatrix(s_q[i], bonematrix);
+
+		bonematrix[0][3] = s_pos[i][0];
+		bonematrix[1][3] = s_pos[i][1];
+		bonematrix[2][3] = s_pos[i][2];
+
+		// parents always precede their children
+		int parent = pbones[i].parent;
+		if (parent < 0 || parent >= i)
+			ConcatTransforms(rotationmatrix, bonematrix, pCache->bones[i]);
+		else
+			ConcatTransforms(pCache->bones[parent], bonematrix, pCache->bones[i]);
+	}
+
+	pCache->numbones = numbones;
+}
+
+const bonecache_t *CBoneCache::Get(CBaseEntity *pEntity)
+{
+	bonepose_t pose;
+	if (!GetPose(pEntity, pose))
+		return nullptr;
+
+	size_t index = indexOfEdict(pEntity->pev);
+	if (index >= m_entries.size())
+		m_entries.resize(max(index + 1, (size_t)gpGlobals->maxEntities), nullptr);
+
+	bonecache_t *pCache = m_entries[index];
+	if (!pCache)
+	{
+		pCache = m_entries[index] = new bonecache_t;
+	}
+	else if (pCache->pose == pose)
+	{
+		return pCache;
+	}
+
+	pCache->pose = pose;
+	SetupBones(pCache);
+	return pCache;
+}
+
+void CBoneCache::Clear()
+{
+	for (auto pCache : m_entries)
+		delete pCache;
+
+	m_entries.clear();
+}
+
+void CBoneCache::GetBoneOrigin(const bonecache_t *pCache, int iBone, Vector &vecOrigin)
+{
+	vecOrigin.x = pCache->bones[iBone][0][3];
+	vecOrigin.y = pCache->bones[iBone][1][3];
+	vecOrigin.z = pCache->bones[iBone][2][3];
+}
+
+void CBoneCache::GetAttachmentOrigin(const bonecache_t *pCache, int iAttachment, Vector &vecOrigin)
+{
+	const studiohdr_t *pstudiohdr = pCache->pose.pstudiohdr;
+	const mstudioattachment_t *pattachment = (const mstudioattachment_t *)((const byte *)pstudiohdr + pstudiohdr->attachmentindex) + iAttachment;
+	const bonematrix_t &bone = pCache->bones[pattachment->bone];
+
+	vecOrigin.x = pattachment->org[0] * bone[0][0] + pattachment->org[1] * bone[0][1] + pattachment->org[2] * bone[0][2] + bone[0][3];
+	vecOrigin.y = pattachment->org[0] * bone[1][0] + pattachment->org[1] * bone[1][1] + pattachment->org[2] * bone[1][2] + bone[1][3];
+	vecOrigin.z = pattachment->org[0] * bone[2][0] + pattachment->org[1] * bone[2][1] + pattachment->org[2] * bone[2][2] + bone[2][3];
+}
+
+bool CBoneCache::IntersectBox(const Vector &vecStart, const Vector &vecDir, float flMaxDist, const float *vecMins, const float *vecMaxs, float &flDist)
+{
+	float tmin = 0.0f;
+	float tmax = flMaxDist;
+
+	for (int i = 0; i < 3; i++)
+	{
+		if (fabs(vecDir[i]) < 0.000001f)
+		{
+			// parallel to the slab
+			if (vecStart[i] < vecMins[i] || vecStart[i] > vecMaxs[i])
+				return false;
+
+			continue;
+		}
+
+		float t1 = (vecMins[i] - vecStart[i]) / vecDir[i];
+		float t2 = (vecMaxs[i] - vecStart[i]) / vecDir[i];
+
+		if (t1 > t2)
+			std::swap(t1, t2);
+
+		tmin = max(tmin, t1);
+		tmax = min(tmax, t2);
+
+		if (tmin > tmax)
+			return false;
+	}
+
+	flDist = tmin;
+	return true;
+}
+
+bool CBoneCache::IntersectHitbox(const bonecache_t *pCache, const mstudiobbox_t *pbox, const Vector &vecStart, const Vector &vecDir, float flMaxDist, float &flDist)
+{
+	const bonematrix_t &bone = pCache->bones[pbox->bone];
+
+	// bring the ray into the bone space, the bone matrices are orthonormal
+	Vector vecDelta(vecStart.x - bone[0][3], vecStart.y - bone[1][3], vecStart.z - bone[2][3]);
+	Vector vecLocalStart, vecLocalDir;
+
+	for (int i = 0; i < 3; i++)
+	{
+		vecLocalStart[i] = vecDelta.x * bone[0][i] + vecDelta.y * bone[1][i] + vecDelta.z * bone[2][i];
+		vecLocalDir[i] = vecDir.x * bone[0][i] + vecDir.y * bone[1][i] + vecDir.z * bone[2][i];
+	}
+
+	return IntersectBox(vecLocalStart, vecLocalDir, flMaxDist, pbox->bbmin, pbox->bbmax, flDist);
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+typedef float bonematrix_t[3][4];
+
+// Everything the bone transforms of an entity depend on
+struct bonepose_t
+{
+	studiohdr_t *pstudiohdr;
+	int sequence;
+	float frame;
+	Vector origin;
+	Vector angles;
+	byte controller[4];
+	byte blending[2];
+	int gaitsequence;   // players only, 0 if the legs follow the main sequence
+	float gaitframe;
+
+	bool operator==(const bonepose_t &other) const;
+};
+
+// Skeleton of an entity evaluated for one pose
+struct bonecache_t
+{
+	bonepose_t pose;
+	int numbones;
+	bonematrix_t bones[MAXSTUDIOBONES];
+};
+
+// Evaluates all bones of an entity at once and keeps them until the pose of the entity changes,
+// so that querying many bones of the same entity in a frame costs a single skeleton setup.
+class CBoneCache
+{
+public:
+	~CBoneCache() { Clear(); }
+
+	// Returns the skeleton for the current pose of the entity,
+	// nullptr if the model can't be evaluated (no studio model, demand loaded sequence group)
+	const bonecache_t *Get(CBaseEntity *pEntity);
+
+	// Releases all entries, must be called when the models are unloaded
+	void Clear();
+
+	static void GetBoneOrigin(const bonecache_t *pCache, int iBone, Vector &vecOrigin);
+	static void GetAttachmentOrigin(const bonecache_t *pCache, int iAttachment, Vector &vecOrigin);
+
+	// Ray vs axis aligned box, vecDir must be normalized. Returns the entry distance in flDist.
+	static bool IntersectBox(const Vector &vecStart, const Vector &vecDir, float flMaxDist, const float *vecMins, const float *vecMaxs, float &flDist);
+
+	// Ray vs hitbox oriented by its bone
+	static bool IntersectHitbox(const bonecache_t *pCache, const mstudiobbox_t *pbox, const Vector &vecStart, const Vector &vecDir, float flMaxDist, float &flDist);
+
+private:
+	static bool GetPose(CBaseEntity *pEntity, bonepose_t &pose);
+	static void SetupBones(bonecache_t *pCache);
+
+	std::vector<bonecache_t *> m_entries;
+};
+
+extern CBoneCache g_boneCache;
@@ -28,7 +28,7 @@ DLL_FUNCTIONS gFunctionTable =
 	NULL,					// pfnServerDeactivate
 	NULL,					// pfnPlayerPreThink
 	NULL,					// pfnPlayerPostThink
-	NULL,					// pfnStartFrame
+	&StartFrame,			// pfnStartFrame
 	NULL,					// pfnParmsNewLevel
 	NULL,					// pfnParmsChangeLevel
 	NULL,					// pfnGetGameDescription
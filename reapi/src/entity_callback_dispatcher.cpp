@@ -39,6 +39,37 @@ void CEntityCallbackDispatcher::DeleteExistingCallbacks(CBaseEntity *pEntity, Ca
 		m_callbacks.clear();
 }
 
+// Deletes the callbacks of the marked entities
+void CEntityCallbackDispatcher::DeleteExistingCallbacks(const std::vector<bool> &marks)
+{
+	for (std::list<EntityCallback *>::const_iterator it = m_callbacks.begin();
+		it != m_callbacks.end(); )
+	{
+		EntityCallback *callback = (*it);
+
+		const size_t index = indexOfEdict(callback->m_pEntity->pev);
+		if (index < marks.size() && marks[index])
+		{
+			if (IsProcessingCallbacks())
+			{
+				if (std::find(m_callbacksMarkForDeletion.begin(), m_callbacksMarkForDeletion.end(), callback) == m_callbacksMarkForDeletion.end())
+					m_callbacksMarkForDeletion.push_back(callback);
+
+				it++;
+			}
+			else
+			{
+				it = m_callbacks.erase(it);
+				delete callback;
+			}
+		}
+		else
+		{
+			it++;
+		}
+	}
+}
+
 // Deletes all registered callbacks
 void CEntityCallbackDispatcher::DeleteAllCallbacks()
 {
@@ -41,6 +41,13 @@ public:
 	//
 	void DeleteExistingCallbacks(CBaseEntity *pEntity, CallbackType type = None);
 
+	//
+	// @brief Deletes all callbacks of several entities in a single walk of the list
+	//
+	// @param marks   Flags indexed by entity index, the callbacks of the marked entities are deleted
+	//
+	void DeleteExistingCallbacks(const std::vector<bool> &marks);
+
 	// Are we in the middle of processing callbacks?
 	bool IsProcessingCallbacks() const { return m_bIsProcessingCallbacks; }
 
@@ -68,16 +75,16 @@ public:
 		for (std::list<EntityCallback *>::const_iterator it = m_callbacks.begin();
 				it != m_callbacks.end(); it++)
 		{
-			const EntityCallback *callback = (*it);
+			EntityCallback *callback = (*it);
 
 			// Check if the callback is associated with the specified entity and callback type
 			if (callback->m_pEntity == pEntity && callback->m_callbackType == type)
 			{
 				// Check if user parameters provided for this callback
-				if (callback->m_nUserParamBlockSize > 0)
+				if (!callback->m_userParams.IsEmpty())
 				{
 					// Execute the callback with the provided arguments and user parameters
-					g_amxxapi.ExecuteForward(callback->GetFwdIndex(), args..., g_amxxapi.PrepareCellArrayA(callback->m_pUserParams, callback->m_nUserParamBlockSize, true));
+					g_amxxapi.ExecuteForward(callback->GetFwdIndex(), args..., g_amxxapi.PrepareCellArrayA(callback->m_userParams.GetData(), callback->m_userParams.GetSize(), true));
 				}
 				else
 				{
@@ -129,23 +136,7 @@ private:
 				CAmxxHookBase(amx, funcname, index, -1),
 				m_pEntity(pEntity), m_callbackType(type)
 		{
-			if (iParamsLen > 0) {
-				m_nUserParamBlockSize = iParamsLen + 1;
-				m_pUserParams = new cell[m_nUserParamBlockSize];
-				Q_memcpy(m_pUserParams, pParams, sizeof(cell) * iParamsLen);
-				m_pUserParams[iParamsLen] = 0;
-			} else {
-				m_nUserParamBlockSize = 0;
-				m_pUserParams = nullptr;
-			}
-		}
-
-		~EntityCallback()
-		{
-			if (m_pUserParams)
-				delete[] m_pUserParams;
-			m_pUserParams = nullptr;
-			m_nUserParamBlockSize = 0;
+			m_userParams.Set(pParams, iParamsLen);
 		}
 
 		// Pointer to the entity for which the callback is registered
@@ -155,10 +146,7 @@ private:
 		CallbackType m_callbackType;
 
 		// User-provided data to be passed to their callback function
-		cell *m_pUserParams;
-
-		// The length of user-provided parameters to be passed to their callback function
-		size_t m_nUserParamBlockSize;
+		CAmxxUserParams m_userParams;
 	};
 
 	// Flag indicating that callback processing is currently in progress
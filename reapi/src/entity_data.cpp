@@ -0,0 +1,136 @@
+#include "precompiled.h"
+
+CEntityData g_entityData;
+
+int CEntityData::CreateKey(AMX *amx, const char *name)
+{
+	for (size_t i = 0; i < m_keys.size(); i++)
+	{
+		if (m_keys[i].amx == amx && m_keys[i].name == name)
+			return i;
+	}
+
+	m_keys.push_back({ amx, name });
+	return m_keys.size() - 1;
+}
+
+int CEntityData::CreateTag(const char *name)
+{
+	for (size_t i = 0; i < m_tags.size(); i++)
+	{
+		if (!Q_stricmp(m_tags[i].name.c_str(), name))
+			return i;
+	}
+
+	if (m_tags.size() >= ENTITY_MAX_TAGS)
+		return -1;
+
+	m_tags.emplace_back();
+	m_tags.back().name = name;
+	return m_tags.size() - 1;
+}
+
+CEntityData::entitydata_t *CEntityData::GetEntity(int entity)
+{
+	if (size_t(entity) >= m_entities.size())
+		m_entities.resize(max(entity + 1, gpGlobals->maxEntities + 1), entitydata_t{ 0, 0 });
+
+	return &m_entities[entity];
+}
+
+cell CEntityData::GetValue(int entity, int key) const
+{
+	if (size_t(entity) >= m_entities.size())
+		return 0;
+
+	const entitydata_t &data = m_entities[entity];
+	if (size_t(key) >= data.values.size())
+		return 0;
+
+	return data.values[key];
+}
+
+void CEntityData::SetValue(int entity, int key, cell value)
+{
+	entitydata_t *data = GetEntity(entity);
+	if (size_t(key) >= data->values.size())
+	{
+		if (!value)
+			return;
+
+		data->values.resize(key + 1, 0);
+	}
+
+	data->values[key] = value;
+}
+
+bool CEntityData::HasTag(int entity, int tag) const
+{
+	if (size_t(entity) >= m_entities.size())
+		return false;
+
+	return (m_entities[entity].tags & (1ull << tag)) != 0;
+}
+
+void CEntityData::SetTag(int entity, int tag, bool set)
+{
+	entitydata_t *data = GetEntity(entity);
+	const uint64 bit = 1ull << tag;
+
+	if (((data->tags & bit) != 0) == set)
+		return;
+
+	tag_t &t = m_tags[tag];
+	if (set)
+	{
+		if (size_t(entity) >= t.position.size())
+			t.position.resize(m_entities.size(), -1);
+
+		t.position[entity] = t.entities.size();
+		t.entities.push_back(entity);
+		data->tags |= bit;
+	}
+	else
+	{
+		// swap with the last one to keep the list packed
+		const int pos = t.position[entity];
+		const int last = t.entities.back();
+
+		t.entities[pos] = last;
+		t.position[last] = pos;
+		t.entities.pop_back();
+		t.position[entity] = -1;
+		data->tags &= ~bit;
+	}
+}
+
+uint32 CEntityData::GetGeneration(int entity) const
+{
+	if (size_t(entity) >= m_entities.size())
+		return 0;
+
+	return m_entities[entity].generation;
+}
+
+void CEntityData::OnEntityFreed(int entity)
+{
+	// the table is grown here as well, so that every free bumps the generation
+	// even if no plugin has stored any data yet
+	entitydata_t *data = GetEntity(entity);
+
+	for (size_t tag = 0; data->tags; tag++)
+	{
+		if (data->tags & (1ull << tag))
+			SetTag(entity, tag, false);
+	}
+
+	data->values.clear();
+	data->generation++;
+}
+
+void CEntityData::Clear()
+{
+	m_entities.clear();
+	m_keys.clear();
+	m_tags.clear();
+}
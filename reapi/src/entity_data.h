@@ -0,0 +1,62 @@
+#pragma once
+
+#define ENTITY_MAX_TAGS     64
+
+// Side table of plugin data attached to entities, indexed by edict number.
+// Every entity has a value slot per registered key and a set of tags,
+// both are released when the entity is freed.
+class CEntityData
+{
+public:
+	// Returns the key id, the same name registered by different plugins gives different keys
+	int CreateKey(AMX *amx, const char *name);
+	bool IsValidKey(int key) const { return key >= 0 && size_t(key) < m_keys.size(); }
+
+	// Returns the tag id or -1 if there are no free tags, tags are shared between the plugins
+	int CreateTag(const char *name);
+	bool IsValidTag(int tag) const { return tag >= 0 && size_t(tag) < m_tags.size(); }
+
+	cell GetValue(int entity, int key) const;
+	void SetValue(int entity, int key, cell value);
+
+	bool HasTag(int entity, int tag) const;
+	void SetTag(int entity, int tag, bool set);
+
+	// Entities with the tag, in no particular order
+	const std::vector<int> &GetTagged(int tag) const { return m_tags[tag].entities; }
+
+	// Incremented every time the entity is freed, so that a stored index can be checked for reuse
+	uint32 GetGeneration(int entity) const;
+
+	void OnEntityFreed(int entity);
+	void Clear();
+
+private:
+	struct entitydata_t
+	{
+		uint32 generation;
+		uint64 tags;
+		std::vector<cell> values;   // grown up to the highest key set
+	};
+
+	struct key_t
+	{
+		AMX *amx;
+		std::string name;
+	};
+
+	struct tag_t
+	{
+		std::string name;
+		std::vector<int> entities;
+		std::vector<int> position;  // index of the entity in the entities list, -1 if untagged
+	};
+
+	entitydata_t *GetEntity(int entity);
+
+	std::vector<entitydata_t> m_entities;
+	std::vector<key_t> m_keys;
+	std::vector<tag_t> m_tags;
+};
+
+extern CEntityData g_entityData;
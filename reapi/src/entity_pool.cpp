@@ -0,0 +1,220 @@
+#include "precompiled.h"
+
+CEntityPool g_entityPool;
+
+int CEntityPool::FindPool(const char *classname) const
+{
+	for (size_t i = 0; i < m_pools.size(); i++)
+	{
+		if (!Q_strcmp(STRING(m_pools[i].classname), classname))
+			return i;
+	}
+
+	return -1;
+}
+
+int CEntityPool::GetPool(const char *classname)
+{
+	int index = FindPool(classname);
+	if (index != -1)
+		return index;
+
+	// the classname is allocated once for all the entities of the pool
+	pool_t pool = {};
+	pool.classname = ALLOC_STRING(classname);
+	pool.size = ENTITY_POOL_DEFAULT_SIZE;
+
+	m_pools.push_back(pool);
+	return m_pools.size() - 1;
+}
+
+CEntityPool::entitystate_t *CEntityPool::GetState(int entity)
+{
+	if (size_t(entity) >= m_entities.size())
+		m_entities.resize(max(entity + 1, gpGlobals->maxEntities + 1), entitystate_t{ -1, false });
+
+	return &m_entities[entity];
+}
+
+int CEntityPool::Acquire(const char *classname)
+{
+	const int index = GetPool(classname);
+	pool_t &pool = m_pools[index];
+
+	int entity;
+	if (!pool.parked.empty())
+	{
+		entity = pool.parked.back();
+		pool.parked.pop_back();
+
+		Reset(getPrivate<CBaseEntity>(entity));
+
+		pool.stats.parked--;
+		pool.stats.reused++;
+	}
+	else
+	{
+		edict_t *pEdict = CREATE_NAMED_ENTITY(pool.classname);
+		if (!pEdict || !pEdict->pvPrivateData)
+			return 0;
+
+		entity = indexOfEdict(pEdict);
+		pool.stats.created++;
+	}
+
+	entitystate_t *state = GetState(entity);
+	state->pool = index;
+	state->parked = false;
+
+	pool.stats.active++;
+	return entity;
+}
+
+bool CEntityPool::Release(int entity)
+{
+	if (size_t(entity) >= m_entities.size())
+		return false;
+
+	entitystate_t &state = m_entities[entity];
+	if (state.pool == -1 || state.parked)
+		return false;
+
+	CBaseEntity *pEntity = getPrivate<CBaseEntity>(entity);
+	pool_t &pool = m_pools[state.pool];
+
+	pool.stats.active--;
+
+	// drop everything reapi keeps for the entity, as if it was freed
+	EntityCallbackDispatcher().DeleteExistingCallbacks(pEntity);
+	g_timerWheel.OnEntityFreed(entity);
+	g_entityData.OnEntityFreed(entity);
+
+	if (pool.parked.size() >= size_t(pool.size))
+	{
+		state.pool = -1;
+		pEntity->pev->flags |= FL_KILLME;
+		pool.stats.discarded++;
+		return true;
+	}
+
+	Park(pEntity);
+
+	state.parked = true;
+	pool.parked.push_back(entity);
+	pool.stats.parked++;
+	return true;
+}
+
+// Hides the entity and stops it from interacting with the world
+void CEntityPool::Park(CBaseEntity *pEntity)
+{
+	entvars_t *pev = pEntity->pev;
+
+	pEntity->SetThink(nullptr);
+	pEntity->SetTouch(nullptr);
+	pEntity->SetUse(nullptr);
+	pEntity->SetBlocked(nullptr);
+
+	pev->effects |= EF_NODRAW;
+	pev->solid = SOLID_NOT;
+	pev->movetype = MOVETYPE_NONE;
+	pev->takedamage = DAMAGE_NO;
+	pev->nextthink = 0;
+	pev->velocity = Vector(0, 0, 0);
+	pev->avelocity = Vector(0, 0, 0);
+	pev->owner = nullptr;
+	pev->aiment = nullptr;
+
+	SET_ORIGIN(ENT(pev), Vector(0, 0, 0));
+}
+
+// Brings entvars and the base members back to the state of a newly created entity
+void CEntityPool::Reset(CBaseEntity *pEntity)
+{
+	entvars_t *pev = pEntity->pev;
+	edict_t *pEdict = pev->pContainingEntity;
+	string_t classname = pev->classname;
+
+	Q_memset((void *)pev, 0, sizeof(*pev));
+	pev->pContainingEntity = pEdict;
+	pev->classname = classname;
+
+	pEntity->m_pGoalEnt = nullptr;
+	pEntity->m_pLink = nullptr;
+	pEntity->SetThink(nullptr);
+	pEntity->SetTouch(nullptr);
+	pEntity->SetUse(nullptr);
+	pEntity->SetBlocked(nullptr);
+
+	Q_memset(&pEntity->currentammo, 0, (byte *)&pEntity->has_disconnected - (byte *)&pEntity->currentammo);
+	pEntity->has_disconnected = false;
+
+	// the slot of m_pEntity is the unused current_ammo pointer in the stock game dll
+	if (api_cfg.hasReGameDLL() && pEntity->m_pEntity)
+	{
+		pEntity->m_pEntity->m_ucDmgPenetrationLevel = 0;
+		pEntity->m_pEntity->m_pevLastInflictor = nullptr;
+	}
+
+	SET_ORIGIN(pEdict, Vector(0, 0, 0));
+}
+
+void CEntityPool::SetSize(const char *classname, int size)
+{
+	pool_t &pool = m_pools[GetPool(classname)];
+	pool.size = max(size, 0);
+
+	while (pool.parked.size() > size_t(pool.size))
+	{
+		const int entity = pool.parked.back();
+		pool.parked.pop_back();
+
+		m_entities[entity].pool = -1;
+		m_entities[entity].parked = false;
+		edictByIndex(entity)->v.flags |= FL_KILLME;
+
+		pool.stats.parked--;
+		pool.stats.discarded++;
+	}
+}
+
+bool CEntityPool::GetStats(const char *classname, stats_t &stats) const
+{
+	const int index = FindPool(classname);
+	if (index == -1)
+		return false;
+
+	stats = m_pools[index].stats;
+	return true;
+}
+
+void CEntityPool::OnEntityFreed(int entity)
+{
+	if (size_t(entity) >= m_entities.size())
+		return;
+
+	entitystate_t &state = m_entities[entity];
+	if (state.pool == -1)
+		return;
+
+	// removed by something else while acquired or parked
+	pool_t &pool = m_pools[state.pool];
+	if (state.parked)
+	{
+		pool.parked.erase(std::find(pool.parked.begin(), pool.parked.end(), entity));
+		pool.stats.parked--;
+	}
+	else
+	{
+		pool.stats.active--;
+	}
+
+	state.pool = -1;
+	state.parked = false;
+}
+
+void CEntityPool::Clear()
+{
+	m_pools.clear();
+	m_entities.clear();
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#define ENTITY_POOL_DEFAULT_SIZE    64
+
+// Keeps released entities parked instead of freeing them, so that plugins
+// creating and removing many short-lived entities of the same classname
+// reuse the edicts and the private data instead of reallocating them.
+class CEntityPool
+{
+public:
+	struct stats_t
+	{
+		int parked;     // entities waiting in the pool
+		int active;     // entities acquired from the pool and not released yet
+		int created;    // acquires that had to create a new entity
+		int reused;     // acquires served by a parked entity
+		int discarded;  // releases that removed the entity because the pool was full
+	};
+
+	// Returns the entity index or 0 if the entity can't be created
+	int Acquire(const char *classname);
+
+	// Parks the entity, returns false if it wasn't acquired from a pool
+	bool Release(int entity);
+
+	// Max amount of parked entities of the classname, the excess ones are removed on release
+	void SetSize(const char *classname, int size);
+	bool GetStats(const char *classname, stats_t &stats) const;
+
+	void OnEntityFreed(int entity);
+	void Clear();
+
+private:
+	struct pool_t
+	{
+		string_t classname;
+		int size;
+		std::vector<int> parked;
+		stats_t stats;
+	};
+
+	struct entitystate_t
+	{
+		int pool;       // -1 if the entity doesn't belong to a pool
+		bool parked;
+	};
+
+	int FindPool(const char *classname) const;
+	int GetPool(const char *classname);
+	entitystate_t *GetState(int entity);
+
+	static void Park(CBaseEntity *pEntity);
+	static void Reset(CBaseEntity *pEntity);
+
+	std::vector<pool_t> m_pools;
+	std::vector<entitystate_t> m_entities;
+};
+
+extern CEntityPool g_entityPool;
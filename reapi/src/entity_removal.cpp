@@ -0,0 +1,69 @@
+#include "precompiled.h"
+
+CEntityRemovalQueue g_entityRemoval;
+
+bool CEntityRemovalQueue::Queue(int entity)
+{
+	if (size_t(entity) >= m_queued.size())
+		m_queued.resize(max(entity + 1, gpGlobals->maxEntities + 1), false);
+
+	if (m_queued[entity])
+		return false;
+
+	m_queued[entity] = true;
+	m_queue.push_back(entity);
+	return true;
+}
+
+void CEntityRemovalQueue::Flush()
+{
+	if (m_queue.empty())
+		return;
+
+	// the callbacks of all the queued entities are dropped in one walk of the list,
+	// OnFreeEntPrivateData doesn't walk it again for each one
+	EntityCallbackDispatcher().DeleteExistingCallbacks(m_queued);
+
+	// removing reaches plugin code, the entities it queues are kept for the next frame
+	m_flushed.swap(m_queue);
+
+	for (int entity : m_flushed)
+	{
+		// freed by something else after it was queued
+		if (!m_queued[entity])
+			continue;
+
+		edict_t *pEdict = edictByIndex(entity);
+		if (!pEdict->free)
+		{
+			m_removing = entity;
+
+			// same game side cleanup as UTIL_Remove, unless the game already did it
+			CBaseEntity *pEntity = getPrivate<CBaseEntity>(pEdict);
+			if (api_cfg.hasReGameDLL() && pEntity && !(pEdict->v.flags & FL_KILLME))
+				pEntity->UpdateOnRemove();
+
+			REMOVE_ENTITY(pEdict);
+			m_removing = -1;
+		}
+
+		m_queued[entity] = false;
+	}
+
+	m_flushed.clear();
+}
+
+void CEntityRemovalQueue::OnEntityFreed(int entity)
+{
+	// a new entity can take the index before the flush, it must not be removed
+	if (entity != m_removing && IsQueued(entity))
+		m_queued[entity] = false;
+}
+
+void CEntityRemovalQueue::Clear()
+{
+	m_queue.clear();
+	m_flushed.clear();
+	m_queued.clear();
+	m_removing = -1;
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+// Collects entity removals requested during the frame and performs them
+// in one pass at the frame boundary, before any entity runs again.
+class CEntityRemovalQueue
+{
+public:
+	// Returns false if the entity is already queued
+	bool Queue(int entity);
+	bool IsQueued(int entity) const { return size_t(entity) < m_queued.size() && m_queued[entity]; }
+
+	// Are the callbacks of the entity already deleted by the pass in progress?
+	bool IsFlushing(int entity) const { return entity == m_removing; }
+
+	void Flush();
+
+	void OnEntityFreed(int entity);
+	void Clear();
+
+private:
+	std::vector<int> m_queue;
+	std::vector<int> m_flushed;     // the queue taken by the pass in progress
+	std::vector<bool> m_queued;     // indexed by entity, a set entry is in the queue
+	int m_removing = -1;            // entity being removed by the pass
+};
+
+extern CEntityRemovalQueue g_entityRemoval;
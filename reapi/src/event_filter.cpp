@@ -0,0 +1,144 @@
+#include "precompiled.h"
+
+CEventFilter g_eventFilter;
+
+CEventFilter::CEventFilter()
+{
+	memset(m_userid, 0, sizeof(m_userid));
+}
+
+bool CEventFilter::Add(int eventindex, int entity, int receiver)
+{
+	rules_t &rules = m_rules[receiver];
+
+	if (receiver && m_userid[receiver] != clientOfIndex(receiver)->userid)
+	{
+		m_numRules -= rules.size();
+		rules.clear();
+		m_userid[receiver] = clientOfIndex(receiver)->userid;
+	}
+
+	for (auto &rule : rules)
+	{
+		if (rule.eventindex == eventindex && rule.entity == entity)
+			return false;
+	}
+
+	rules.push_back({ eventindex, entity });
+	m_numRules++;
+
+	UpdateHook();
+	return true;
+}
+
+bool CEventFilter::Remove(int eventindex, int entity, int receiver)
+{
+	rules_t &rules = m_rules[receiver];
+
+	for (auto it = rules.begin(); it != rules.end(); it++)
+	{
+		if (it->eventindex == eventindex && it->entity == entity)
+		{
+			rules.erase(it);
+			m_numRules--;
+
+			UpdateHook();
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void CEventFilter::Clear()
+{
+	for (auto &rules : m_rules)
+		rules.clear();
+
+	memset(m_userid, 0, sizeof(m_userid));
+	m_numRules = 0;
+	UpdateHook();
+}
+
+void CEventFilter::UpdateHook()
+{
+	const bool hook = m_numRules > 0;
+	if (hook == m_hooked)
+		return;
+
+	// ahead of the reapi hooks, so that the forwards never see the blocked events
+	if (hook)
+	{
+		g_RehldsHookchains->SV_EmitEvents()->registerHook(&SV_EmitEvents, HC_PRIORITY_HIGH);
+		g_RehldsHookchains->EV_PlayReliableEvent()->registerHook(&EV_PlayReliableEvent, HC_PRIORITY_HIGH);
+	}
+	else
+	{
+		g_RehldsHookchains->SV_EmitEvents()->unregisterHook(&SV_EmitEvents);
+		g_RehldsHookchains->EV_PlayReliableEvent()->unregisterHook(&EV_PlayReliableEvent);
+	}
+
+	m_hooked = hook;
+}
+
+bool CEventFilter::Matches(const rules_t &rules, int eventindex, int entity)
+{
+	for (auto &rule : rules)
+	{
+		if ((!rule.eventindex || rule.eventindex == eventindex) && (!rule.entity || rule.entity == entity))
+			return true;
+	}
+
+	return false;
+}
+
+bool CEventFilter::IsBlocked(int receiver, int eventindex, int entity)
+{
+	if (Matches(m_rules[0], eventindex, entity))
+		return true;
+
+	rules_t &rules = m_rules[receiver];
+	if (rules.empty())
+		return false;
+
+	if (m_userid[receiver] != clientOfIndex(receiver)->userid)
+	{
+		// the hooks are updated by the caller, once the chain has been called
+		m_numRules -= rules.size();
+		rules.clear();
+		return false;
+	}
+
+	return Matches(rules, eventindex, entity);
+}
+
+void CEventFilter::SV_EmitEvents(IRehldsHook_SV_EmitEvents *chain, IGameClient *cl, packet_entities_s *pack, sizebuf_t *msg)
+{
+	const int receiver = cl->GetId() + 1;
+	event_state_t *es = &clientOfIndex(receiver)->events;
+
+	for (auto &ei : es->ei)
+	{
+		if (!ei.index || !g_eventFilter.IsBlocked(receiver, ei.index, ei.entity_index))
+			continue;
+
+		// free the slot the same way the engine does once the event is sent
+		ei.index = 0;
+		ei.packet_index = -1;
+		ei.entity_index = -1;
+	}
+
+	chain->callNext(cl, pack, msg);
+
+	// stale rules may have been dropped
+	g_eventFilter.UpdateHook();
+}
+
+void CEventFilter::EV_PlayReliableEvent(IRehldsHook_EV_PlayReliableEvent *chain, IGameClient *cl, int entindex, unsigned short eventindex, float delay, event_args_s *pargs)
+{
+	if (!g_eventFilter.IsBlocked(cl->GetId() + 1, eventindex, entindex))
+		chain->callNext(cl, entindex, eventindex, delay, pargs);
+
+	// stale rules may have been dropped
+	g_eventFilter.UpdateHook();
+}
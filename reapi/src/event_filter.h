@@ -0,0 +1,44 @@
+#pragma once
+
+// Blocks events (EV_Precache'd, e.g. weapon fire) per receiver without a forward call per event.
+// Queued events are dropped from the client event state before SV_EmitEvents writes them,
+// reliable events are dropped in EV_PlayReliableEvent.
+class CEventFilter
+{
+public:
+	CEventFilter();
+
+	// eventindex, entity and receiver are 0 to match any
+	bool Add(int eventindex, int entity, int receiver);
+	bool Remove(int eventindex, int entity, int receiver);
+
+	// Removes all rules and unregisters the engine hooks
+	void Clear();
+
+private:
+	static void SV_EmitEvents(IRehldsHook_SV_EmitEvents *chain, IGameClient *cl, packet_entities_s *pack, sizebuf_t *msg);
+	static void EV_PlayReliableEvent(IRehldsHook_EV_PlayReliableEvent *chain, IGameClient *cl, int entindex, unsigned short eventindex, float delay, event_args_s *pargs);
+
+	struct rule_t
+	{
+		int eventindex;
+		int entity;
+	};
+
+	typedef std::vector<rule_t> rules_t;
+
+	static bool Matches(const rules_t &rules, int eventindex, int entity);
+	bool IsBlocked(int receiver, int eventindex, int entity);
+	void UpdateHook();
+
+	bool m_hooked = false;
+	size_t m_numRules = 0;
+
+	// the rules for any receiver are at 0
+	rules_t m_rules[MAX_CLIENTS + 1];
+
+	// the rules of a receiver are dropped when another client takes the slot
+	int m_userid[MAX_CLIENTS + 1];
+};
+
+extern CEventFilter g_eventFilter;
@@ -258,6 +258,39 @@ void SV_SendResources(IRehldsHook_SV_SendResources *chain, sizebuf_t *msg)
 	SV_SendResources_AMXX(&data, g_RehldsFuncs->GetHostClient());
 }
 
+void SV_EmitEvents_AMXX(SV_EmitEvents_t *data, IGameClient *cl)
+{
+	auto original = [data](int _cl)
+	{
+		data->m_chain->callNext(clientByIndex(_cl), data->m_args.pack, data->m_args.msg);
+	};
+
+	callVoidForward(RH_SV_EmitEvents, original, cl->GetId() + 1);
+}
+
+void SV_EmitEvents(IRehldsHook_SV_EmitEvents *chain, IGameClient *cl, packet_entities_s *pack, sizebuf_t *msg)
+{
+	SV_EmitEvents_args_t args(pack, msg);
+	SV_EmitEvents_t data(chain, args);
+	SV_EmitEvents_AMXX(&data, cl);
+}
+
+void EV_PlayReliableEvent_AMXX(EV_PlayReliableEvent_t *data, IGameClient *cl, int entindex, unsigned short eventindex, float delay)
+{
+	auto original = [data](int _cl, int _entindex, unsigned short _eventindex, float _delay)
+	{
+		data->m_chain->callNext(clientByIndex(_cl), _entindex, _eventindex, _delay, data->m_args);
+	};
+
+	callVoidForward(RH_EV_PlayReliableEvent, original, cl->GetId() + 1, entindex, eventindex, delay);
+}
+
+void EV_PlayReliableEvent(IRehldsHook_EV_PlayReliableEvent *chain, IGameClient *cl, int entindex, unsigned short eventindex, float delay, event_args_s *pargs)
+{
+	EV_PlayReliableEvent_t data(chain, pargs);
+	EV_PlayReliableEvent_AMXX(&data, cl, entindex, eventindex, delay);
+}
+
 /*
 * ReGameDLL functions
 */
@@ -83,7 +83,7 @@ struct hookctx_t
 	hookctx_t(size_t arg_count, t_args&&... args)
 	{
 		if (hasStringArgs(args...)) {
-			tempstrings_used = 0;
+			s_temp_strings.enter();
 		}
 
 		args_count = min(arg_count, MAX_HOOKCHAIN_ARGS);
@@ -120,16 +120,9 @@ struct hookctx_t
 		retVal.type = ret_type;
 	}
 
-	char* get_temp_string(AMX* amx)
+	char* get_temp_string(size_t size)
 	{
-		auto ptr = s_temp_strings.push(amx);
-		if (likely(ptr)) {
-			tempstrings_used++;
-			return ptr;
-		}
-
-		static char fatalErr[] = "<reapi error>";
-		return fatalErr;
+		return s_temp_strings.alloc(size);
 	}
 
 	void SetId(int id) { index = id; }
@@ -137,12 +130,11 @@ struct hookctx_t
 
 	void clear_temp_strings() const
 	{
-		s_temp_strings.pop(tempstrings_used);
+		s_temp_strings.leave();
 	}
 
 	int index                       = 0;
 	retval_t retVal                 = {false,ATYPE_INTEGER};
-	size_t tempstrings_used         = 0;
 
 	struct args_t
 	{
@@ -157,6 +149,50 @@ struct hookctx_t
 
 extern hookctx_t* g_hookCtx;
 
+// marshalling for direct amx_Exec, only used by hooks where every forward param is a cell
+inline cell toAmxCell(float value) { return amx_FloatToCell(value); }
+inline cell toAmxCell(bool value)  { return value ? TRUE : FALSE; }
+
+template <typename T>
+inline cell toAmxCell(T value)     { return (cell)value; }
+
+inline void pushAmxArgs(AMX *amx) {}
+
+template <typename T, typename ...f_args>
+inline void pushAmxArgs(AMX *amx, T &&arg, f_args&&... args)
+{
+	// amx expects params pushed in reverse order
+	pushAmxArgs(amx, std::forward<f_args &&>(args)...);
+	g_amxxapi.amx_Push(amx, toAmxCell(static_cast<typename std::decay<T>::type>(arg)));
+}
+
+template <typename ...f_args>
+int executeForward(CAmxxHookBase *fwd, f_args&&... args)
+{
+	if (likely(!fwd->IsDirectExec()))
+		return g_amxxapi.ExecuteForward(fwd->GetFwdIndex(), std::forward<f_args &&>(args)...);
+
+	AMX *amx = fwd->GetAmx();
+	pushAmxArgs(amx, std::forward<f_args &&>(args)...);
+
+	cell ret = 0;
+	int err = g_amxxapi.amx_Exec(amx, &ret, fwd->GetFuncIndex());
+	if (unlikely(err != AMX_ERR_NONE))
+	{
+		fwd->Error(err, "amx_Exec failed");
+		return HC_CONTINUE;
+	}
+
+	return ret;
+}
+
+template <typename ...f_args>
+void deferForward(CAmxxHookBase *fwd, f_args&&... args)
+{
+	cell event[sizeof...(args) + 1] = { toAmxCell(static_cast<typename std::decay<f_args>::type>(args))... };
+	g_hookManager.QueueEvent(fwd, event, sizeof...(args));
+}
+
 template <typename original_t, typename ...f_args>
 NOINLINE void DLLEXPORT _callVoidForward(hook_t* hook, original_t original, f_args&&... args)
 {
@@ -171,7 +207,7 @@ NOINLINE void DLLEXPORT _callVoidForward(hook_t* hook, original_t original, f_ar
 		if (likely(fwd->GetState() == FSTATE_ENABLED))
 		{
 			hookCtx->SetId(fwd->GetIndex()); // set current handler hook
-			int ret = g_amxxapi.ExecuteForward(fwd->GetFwdIndex(), std::forward<f_args &&>(args)...);
+			int ret = executeForward(fwd, std::forward<f_args &&>(args)...);
 			hookCtx->ResetId();
 
 			if (unlikely(ret == HC_BREAK))
@@ -198,8 +234,13 @@ NOINLINE void DLLEXPORT _callVoidForward(hook_t* hook, original_t original, f_ar
 		{
 			if (likely(fwd->GetState() == FSTATE_ENABLED))
 			{
+				if (unlikely(fwd->IsDeferred())) {
+					deferForward(fwd, std::forward<f_args &&>(args)...);
+					continue;
+				}
+
 				hookCtx->SetId(fwd->GetIndex()); // set current handler hook
-				int ret = g_amxxapi.ExecuteForward(fwd->GetFwdIndex(), std::forward<f_args &&>(args)...);
+				int ret = executeForward(fwd, std::forward<f_args &&>(args)...);
 				hookCtx->ResetId();
 
 				if (unlikely(ret == HC_BREAK || ret == HC_BYPASS))
@@ -243,7 +284,7 @@ NOINLINE R DLLEXPORT _callForward(hook_t* hook, original_t original, f_args&&...
 		if (likely(fwd->GetState() == FSTATE_ENABLED))
 		{
 			hookCtx->SetId(fwd->GetIndex()); // set current handler hook
-			auto ret = g_amxxapi.ExecuteForward(fwd->GetFwdIndex(), std::forward<f_args &&>(args)...);
+			auto ret = executeForward(fwd, std::forward<f_args &&>(args)...);
 			hookCtx->ResetId();
 
 			if (unlikely(ret != HC_SUPERCEDE && ret != HC_BREAK)) {
@@ -294,8 +335,13 @@ NOINLINE R DLLEXPORT _callForward(hook_t* hook, original_t original, f_args&&...
 	{
 		if (likely(fwd->GetState() == FSTATE_ENABLED))
 		{
+			if (unlikely(fwd->IsDeferred())) {
+				deferForward(fwd, std::forward<f_args &&>(args)...);
+				continue;
+			}
+
 			hookCtx->SetId(fwd->GetIndex()); // set current handler hook
-			auto ret = g_amxxapi.ExecuteForward(fwd->GetFwdIndex(), std::forward<f_args &&>(args)...);
+			auto ret = executeForward(fwd, std::forward<f_args &&>(args)...);
 			hookCtx->ResetId();
 
 			if (unlikely(ret == HC_BREAK))
@@ -383,6 +429,22 @@ using SV_SendResources_t = hookdata_t<IRehldsHook_SV_SendResources *, sizebuf_t
 void SV_SendResources_AMXX(SV_SendResources_t *data, IGameClient *cl);
 void SV_SendResources(IRehldsHook_SV_SendResources *chain, sizebuf_t *msg);
 
+struct SV_EmitEvents_args_t
+{
+	SV_EmitEvents_args_t(packet_entities_s *_pack, sizebuf_t *_msg) : pack(_pack), msg(_msg) {}
+
+	packet_entities_s *pack;
+	sizebuf_t *msg;
+};
+
+using SV_EmitEvents_t = hookdata_t<IRehldsHook_SV_EmitEvents *, SV_EmitEvents_args_t &>;
+void SV_EmitEvents_AMXX(SV_EmitEvents_t *data, IGameClient *cl);
+void SV_EmitEvents(IRehldsHook_SV_EmitEvents *chain, IGameClient *cl, packet_entities_s *pack, sizebuf_t *msg);
+
+using EV_PlayReliableEvent_t = hookdata_t<IRehldsHook_EV_PlayReliableEvent *, event_args_s *>;
+void EV_PlayReliableEvent_AMXX(EV_PlayReliableEvent_t *data, IGameClient *cl, int entindex, unsigned short eventindex, float delay);
+void EV_PlayReliableEvent(IRehldsHook_EV_PlayReliableEvent *chain, IGameClient *cl, int entindex, unsigned short eventindex, float delay, event_args_s *pargs);
+
 struct EventPrecache_args_t
 {
 	EventPrecache_args_t(int _type) : type(_type) {}
@@ -46,6 +46,18 @@ struct regfunc
 			return g_amxxapi.RegisterSPForwardByName(amx, name, args[Is]...);
 		}
 
+		// true if every param is passed by value, so the forward can be called through amx_Exec
+		bool IsCellsOnly() const
+		{
+			for (size_t i = 0; i < sizeof...(f_args); i++)
+			{
+				if (args[i] != FP_CELL && args[i] != FP_FLOAT)
+					return false;
+			}
+
+			return true;
+		}
+
 	protected:
 		template <size_t current = 0>
 		void setArgs(size_t param_types[], void (*)())
@@ -76,6 +88,13 @@ struct regfunc
 		};
 	}
 
+	template <typename R, typename T, typename ...f_args>
+	static bool cellsOnly(R (*)(T, f_args...))
+	{
+		regargs<f_args...> args;
+		return args.IsCellsOnly();
+	}
+
 	regfunc(const char *name) { UTIL_SysError("%s doesn't match hook definition", name); }	// to cause a amxx module failure.
 	operator regfunc_t() const { return func; }
 	regfunc_t func;
@@ -85,7 +104,7 @@ struct regfunc
 
 int regfunc::current_cell = 1;
 
-#define ENG(h,...) { {}, {}, #h, "ReHLDS", [](){ return api_cfg.hasReHLDS(); }, ((!(RH_##h & (MAX_REGION_RANGE - 1)) ? regfunc::current_cell = 1, true : false) || (RH_##h & (MAX_REGION_RANGE - 1)) == regfunc::current_cell++) ? regfunc(h##__VA_ARGS__) : regfunc(#h#__VA_ARGS__), [](){ g_RehldsHookchains->h()->registerHook(&h); }, [](){ g_RehldsHookchains->h()->unregisterHook(&h); }, false}
+#define ENG(h,...) { {}, {}, #h, "ReHLDS", [](){ return api_cfg.hasReHLDS(); }, ((!(RH_##h & (MAX_REGION_RANGE - 1)) ? regfunc::current_cell = 1, true : false) || (RH_##h & (MAX_REGION_RANGE - 1)) == regfunc::current_cell++) ? regfunc(h##__VA_ARGS__) : regfunc(#h#__VA_ARGS__), [](){ g_RehldsHookchains->h()->registerHook(&h); }, [](){ g_RehldsHookchains->h()->unregisterHook(&h); }, false, regfunc::cellsOnly(h##__VA_ARGS__)}
 hook_t hooklist_engine[] = {
 	ENG(SV_StartSound),
 	ENG(SV_DropClient),
@@ -109,9 +128,11 @@ hook_t hooklist_engine[] = {
 	ENG(SV_AllowPhysent),
 	ENG(ExecuteServerStringCmd),
 	ENG(SV_SendResources, _AMXX),
+	ENG(SV_EmitEvents, _AMXX),
+	ENG(EV_PlayReliableEvent, _AMXX),
 };
 
-#define DLL(h,...) { {}, {}, #h, "ReGameDLL", [](){ return api_cfg.hasReGameDLL(); }, ((!(RG_##h & (MAX_REGION_RANGE - 1)) ? regfunc::current_cell = 1, true : false) || (RG_##h & (MAX_REGION_RANGE - 1)) == regfunc::current_cell++) ? regfunc(h##__VA_ARGS__) : regfunc(#h#__VA_ARGS__), [](){ g_ReGameHookchains->h()->registerHook(&h); }, [](){ g_ReGameHookchains->h()->unregisterHook(&h); }, false}
+#define DLL(h,...) { {}, {}, #h, "ReGameDLL", [](){ return api_cfg.hasReGameDLL(); }, ((!(RG_##h & (MAX_REGION_RANGE - 1)) ? regfunc::current_cell = 1, true : false) || (RG_##h & (MAX_REGION_RANGE - 1)) == regfunc::current_cell++) ? regfunc(h##__VA_ARGS__) : regfunc(#h#__VA_ARGS__), [](){ g_ReGameHookchains->h()->registerHook(&h); }, [](){ g_ReGameHookchains->h()->unregisterHook(&h); }, false, regfunc::cellsOnly(h##__VA_ARGS__)}
 hook_t hooklist_gamedll[] = {
 	DLL(GetForceCamera),
 	DLL(PlayerBlind),
@@ -292,7 +313,7 @@ hook_t hooklist_botmanager[] = {
 	DLL(CBotManager_OnEvent),
 };
 
-#define RCHECK(h,...) { {}, {}, #h, "ReChecker", [](){ return api_cfg.hasRechecker(); }, ((!(RC_##h & (MAX_REGION_RANGE - 1)) ? regfunc::current_cell = 1, true : false) || (RC_##h & (MAX_REGION_RANGE - 1)) == regfunc::current_cell++) ? regfunc(h##__VA_ARGS__) : regfunc(#h#__VA_ARGS__), [](){ g_RecheckerHookchains->h()->registerHook(&h); }, [](){ g_RecheckerHookchains->h()->unregisterHook(&h); }, false}
+#define RCHECK(h,...) { {}, {}, #h, "ReChecker", [](){ return api_cfg.hasRechecker(); }, ((!(RC_##h & (MAX_REGION_RANGE - 1)) ? regfunc::current_cell = 1, true : false) || (RC_##h & (MAX_REGION_RANGE - 1)) == regfunc::current_cell++) ? regfunc(h##__VA_ARGS__) : regfunc(#h#__VA_ARGS__), [](){ g_RecheckerHookchains->h()->registerHook(&h); }, [](){ g_RecheckerHookchains->h()->unregisterHook(&h); }, false, regfunc::cellsOnly(h##__VA_ARGS__)}
 hook_t hooklist_rechecker[] = {
 	RCHECK(FileConsistencyProcess, _AMXX),
 	RCHECK(FileConsistencyFinal),
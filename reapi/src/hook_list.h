@@ -25,6 +25,7 @@ struct hook_t
 	void clear();
 
 	bool wasCalled;
+	bool directExec;                        // all forward params are cells, amx_Exec can be used
 };
 
 extern hook_t hooklist_engine[];
@@ -118,6 +119,8 @@ enum EngineFunc
 	RH_SV_AllowPhysent,
 	RH_ExecuteServerStringCmd,
 	RH_SV_SendResources,
+	RH_SV_EmitEvents,
+	RH_EV_PlayReliableEvent,
 
 	// [...]
 };
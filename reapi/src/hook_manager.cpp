@@ -2,7 +2,7 @@
 
 CHookManager g_hookManager;
 
-int CHookManager::addHandler(AMX *amx, int func, const char *funcname, int forward, bool post) const
+int CHookManager::addHandler(AMX *amx, int func, const char *funcname, int forward, bool post, int funcid, int flags) const
 {
 	auto hook = m_hooklist.getHookSafe(func);
 
@@ -16,15 +16,44 @@ int CHookManager::addHandler(AMX *amx, int func, const char *funcname, int forwa
 	int i = func * MAX_HOOK_FORWARDS + dest.size() + 1;
 	int index = post ? -i : i; // use unsigned ids for post hooks
 
-	dest.push_back(new CAmxxHookBase(amx, funcname, forward, index));
+	// direct execution is only possible when the forward doesn't take strings or arrays
+	if (!hook->directExec || (flags & HOOKFLAG_DEFERRED))
+		flags &= ~HOOKFLAG_DIRECT_EXEC;
+
+	dest.push_back(new CAmxxHookBase(amx, funcname, forward, index, funcid, flags));
 	return index;
 }
 
-void CHookManager::Clear() const
+void CHookManager::Clear()
 {
+	// queued events are dropped together with their forwards
+	m_deferred.clear();
 	m_hooklist.clear();
 }
 
+void CHookManager::QueueEvent(CAmxxHookBase *fwd, const cell *args, size_t count)
+{
+	if (fwd->PushEvent(args, count))
+		m_deferred.push_back(fwd);
+}
+
+void CHookManager::DispatchDeferred()
+{
+	if (m_deferred.empty())
+		return;
+
+	// forwards queued by the handlers are delivered on the next frame
+	m_dispatching.swap(m_deferred);
+
+	for (auto fwd : m_dispatching)
+	{
+		if (fwd->DispatchEvents())
+			m_deferred.push_back(fwd);
+	}
+
+	m_dispatching.clear();
+}
+
 hook_t *CHookManager::getHook(size_t func) const
 {
 	return m_hooklist.getHookSafe(func);
@@ -6,8 +6,8 @@
 class CHookManager
 {
 public:
-	void Clear() const;
-	cell addHandler(AMX *amx, int func, const char *funcname, int forward, bool post) const;
+	void Clear();
+	cell addHandler(AMX *amx, int func, const char *funcname, int forward, bool post, int funcid, int flags) const;
 	hook_t *getHook(size_t func) const;
 	CAmxxHookBase *getAmxxHook(cell hook) const;
 
@@ -15,8 +15,13 @@ public:
 		return m_hooklist[func];
 	}
 
+	// deferred post forwards
+	void QueueEvent(CAmxxHookBase *fwd, const cell *args, size_t count);
+	void DispatchDeferred();
+
 private:
 	hooklist_t m_hooklist;
+	std::vector<CAmxxHookBase *> m_deferred, m_dispatching; // forwards with queued events
 };
 
 extern CHookManager g_hookManager;
@@ -0,0 +1,134 @@
+#include "precompiled.h"
+#include <chrono>
+
+CJobScheduler g_jobScheduler;
+
+int CJobScheduler::Start(AMX *amx, const char *funcname, int budget, const cell *pParams, size_t iParamsLen)
+{
+	int fwdid;
+	if (iParamsLen > 0)
+		fwdid = g_amxxapi.RegisterSPForwardByName(amx, funcname, FP_CELL, FP_CELL, FP_ARRAY, FP_DONE);
+	else
+		fwdid = g_amxxapi.RegisterSPForwardByName(amx, funcname, FP_CELL, FP_CELL, FP_DONE);
+
+	if (fwdid == -1)
+		return 0;
+
+	// ids are never reused within a map
+	int id = ++m_lastId;
+	m_jobs.push_back(new Job(amx, funcname, fwdid, id, clamp(budget, 1, JOB_MAX_BUDGET), pParams, iParamsLen));
+	return id;
+}
+
+CJobScheduler::Job *CJobScheduler::Find(int id) const
+{
+	for (auto job : m_jobs)
+	{
+		if (job->GetIndex() == id && !job->m_finished)
+			return job;
+	}
+
+	return nullptr;
+}
+
+bool CJobScheduler::Stop(int id)
+{
+	Job *job = Find(id);
+	if (!job)
+		return false;
+
+	job->m_finished = true;
+
+	if (!m_running)
+	{
+		m_jobs.erase(std::find(m_jobs.begin(), m_jobs.end(), job));
+		delete job;
+	}
+
+	return true;
+}
+
+bool CJobScheduler::GetStats(int id, uint64 &timeUsed, int &frames, int &calls) const
+{
+	const Job *job = Find(id);
+	if (!job)
+		return false;
+
+	timeUsed = job->m_timeUsed;
+	frames = job->m_frames;
+	calls = job->m_calls;
+	return true;
+}
+
+void CJobScheduler::RunFrame()
+{
+	if (m_jobs.empty())
+		return;
+
+	typedef std::chrono::steady_clock clock;
+
+	m_running = true;
+
+	// jobs started by the callbacks wait for the next frame
+	const size_t numJobs = m_jobs.size();
+
+	for (size_t i = 0; i < numJobs; i++)
+	{
+		Job *job = m_jobs[i];
+		if (job->m_finished)
+			continue;
+
+		const clock::time_point start = clock::now();
+		const clock::time_point deadline = start + std::chrono::microseconds(job->m_budget);
+		clock::time_point now = start;
+
+		job->m_frames++;
+
+		// a job is always called at least once per frame
+		do
+		{
+			cell state;
+			if (!job->m_userParams.IsEmpty())
+				state = g_amxxapi.ExecuteForward(job->GetFwdIndex(), job->GetIndex(), job->m_calls, g_amxxapi.PrepareCellArrayA(job->m_userParams.GetData(), job->m_userParams.GetSize(), true));
+			else
+				state = g_amxxapi.ExecuteForward(job->GetFwdIndex(), job->GetIndex(), job->m_calls);
+
+			job->m_calls++;
+			now = clock::now();
+
+			if (state == JOB_DONE)
+				job->m_finished = true;
+
+			// the callback hasn't run, it's tried again on the next frame
+			else if (state != JOB_CONTINUE)
+				break;
+		}
+		while (!job->m_finished && now < deadline);
+
+		job->m_timeUsed += std::chrono::duration_cast<std::chrono::microseconds>(now - start).count();
+	}
+
+	m_running = false;
+
+	for (auto it = m_jobs.begin(); it != m_jobs.end(); )
+	{
+		if ((*it)->m_finished)
+		{
+			delete (*it);
+			it = m_jobs.erase(it);
+		}
+		else
+		{
+			it++;
+		}
+	}
+}
+
+void CJobScheduler::Clear()
+{
+	for (auto job : m_jobs)
+		delete job;
+
+	m_jobs.clear();
+	m_lastId = 0;
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "amx_hook.h"
+
+#define JOB_MAX_BUDGET  100000  // microseconds per frame
+
+// return values of a job callback, 0 is what ExecuteForward
+// returns when the plugin is paused or the callback has failed
+enum JobState
+{
+	JOB_CONTINUE = 1,
+	JOB_DONE
+};
+
+// Runs resumable plugin jobs from the frame hook, each one is called
+// repeatedly until it's done or its time budget for the frame is spent.
+class CJobScheduler
+{
+public:
+	~CJobScheduler() { Clear(); }
+
+	// Returns the job id or 0 if the callback can't be registered
+	int Start(AMX *amx, const char *funcname, int budget, const cell *pParams, size_t iParamsLen);
+	bool Stop(int id);
+
+	// Time used is in microseconds
+	bool GetStats(int id, uint64 &timeUsed, int &frames, int &calls) const;
+
+	void RunFrame();
+	void Clear();
+
+private:
+	class Job: public CAmxxHookBase
+	{
+	public:
+		Job(AMX *amx, const char *funcname, int fwdid, int id, int budget, const cell *pParams, size_t iParamsLen) :
+			CAmxxHookBase(amx, funcname, fwdid, id),
+			m_budget(budget), m_timeUsed(0), m_frames(0), m_calls(0), m_finished(false)
+		{
+			m_userParams.Set(pParams, iParamsLen);
+		}
+
+		// Microseconds the job may use per frame
+		int m_budget;
+
+		uint64 m_timeUsed;
+		int m_frames;
+		int m_calls;
+
+		// Done or stopped, deleted once the frame is over
+		bool m_finished;
+
+		// User-provided data passed to the callback, changes made by the callback are kept between calls
+		CAmxxUserParams m_userParams;
+	};
+
+	Job *Find(int id) const;
+
+	std::vector<Job *> m_jobs;
+	int m_lastId = 0;
+	bool m_running = false;
+};
+
+extern CJobScheduler g_jobScheduler;
@@ -0,0 +1,215 @@
+#include "precompiled.h"
+
+CLagCompensation g_lagCompensation;
+
+void CLagCompensation::SetHistory(int numRecords)
+{
+	numRecords = clamp(numRecords, 0, LAGCOMP_MAX_RECORDS);
+	if (numRecords == m_numRecords)
+		return;
+
+	Restore();
+
+	m_numRecords = numRecords;
+
+	for (auto &history : m_history)
+	{
+		history.records.clear();
+		history.records.shrink_to_fit();
+		history.records.resize(numRecords);
+		history.head = 0;
+		history.count = 0;
+	}
+}
+
+void CLagCompensation::Record()
+{
+	if (!m_numRecords)
+		return;
+
+	const int maxClients = min(gpGlobals->maxClients, MAX_CLIENTS);
+
+	for (int i = 1; i <= maxClients; i++)
+	{
+		history_t &history = m_history[i];
+
+		CBasePlayer *pPlayer = UTIL_PlayerByIndex(i);
+		if (!pPlayer || pPlayer->has_disconnected || !pPlayer->IsAlive())
+		{
+			// don't rewind into a previous life
+			history.count = 0;
+			continue;
+		}
+
+		Save(pPlayer, history.records[history.head]);
+
+		history.head = (history.head + 1) % m_numRecords;
+		if (history.count < m_numRecords)
+			history.count++;
+	}
+}
+
+bool CLagCompensation::Lookup(int index, float flTargetTime, lagrecord_t &result) const
+{
+	const history_t &history = m_history[index];
+	if (!history.count)
+		return false;
+
+	// walk from the newest record back to the first one older than the target time
+	const lagrecord_t *pNewer = nullptr;
+	for (int i = 0; i < history.count; i++)
+	{
+		const lagrecord_t &record = history.records[(history.head - 1 - i + m_numRecords) % m_numRecords];
+		if (record.time > flTargetTime)
+		{
+			pNewer = &record;
+			continue;
+		}
+
+		result = record;
+
+		if (pNewer && pNewer->time > record.time)
+		{
+			// teleported in between, don't interpolate the position
+			float flFrac = (flTargetTime - record.time) / (pNewer->time - record.time);
+			if ((pNewer->origin - record.origin).Length() < 64.0f)
+				result.origin = record.origin + (pNewer->origin - record.origin) * flFrac;
+		}
+
+		return true;
+	}
+
+	// the history doesn't go back far enough, use the oldest state
+	result = *pNewer;
+	return true;
+}
+
+int CLagCompensation::Rewind(int client, float flTargetTime)
+{
+	Restore();
+
+	if (!m_numRecords)
+		return 0;
+
+	flTargetTime = max(flTargetTime, gpGlobals->time - LAGCOMP_MAX_UNLAG);
+
+	int numMoved = 0;
+	const int maxClients = min(gpGlobals->maxClients, MAX_CLIENTS);
+
+	for (int i = 1; i <= maxClients; i++)
+	{
+		m_moved[i] = false;
+
+		if (i == client)
+			continue;
+
+		CBasePlayer *pPlayer = UTIL_PlayerByIndex(i);
+		if (!pPlayer || pPlayer->has_disconnected || !pPlayer->IsAlive())
+			continue;
+
+		lagrecord_t record;
+		if (!Lookup(i, flTargetTime, record))
+			continue;
+
+		// the bone setup advances the frame by the time elapsed since animtime,
+		// shift animtime by the rewound interval so that it lands on the recorded frame
+		if (record.animtime != 0.0f)
+			record.animtime += gpGlobals->time - record.time;
+
+		Save(pPlayer, m_backup[i]);
+		Apply(pPlayer, record);
+
+		m_moved[i] = true;
+		numMoved++;
+	}
+
+	m_rewound = true;
+	return numMoved;
+}
+
+void CLagCompensation::Restore()
+{
+	if (!m_rewound)
+		return;
+
+	const int maxClients = min(gpGlobals->maxClients, MAX_CLIENTS);
+
+	for (int i = 1; i <= maxClients; i++)
+	{
+		if (!m_moved[i])
+			continue;
+
+		m_moved[i] = false;
+
+		CBasePlayer *pPlayer = UTIL_PlayerByIndex(i);
+		if (pPlayer && !pPlayer->has_disconnected)
+			Apply(pPlayer, m_backup[i]);
+	}
+
+	m_rewound = false;
+}
+
+float CLagCompensation::GetViewTime(int client)
+{
+	client_t *pClient = clientOfIndex(client);
+	if (!pClient)
+		return gpGlobals->time;
+
+	return gpGlobals->time - pClient->latency - pClient->lastcmd.lerp_msec / 1000.0f;
+}
+
+void CLagCompensation::Clear()
+{
+	m_rewound = false;
+
+	for (int i = 0; i <= MAX_CLIENTS; i++)
+	{
+		m_history[i].head = 0;
+		m_history[i].count = 0;
+		m_moved[i] = false;
+	}
+}
+
+void CLagCompensation::Save(CBasePlayer *pPlayer, lagrecord_t &record)
+{
+	entvars_t *pev = pPlayer->pev;
+
+	record.time         = gpGlobals->time;
+	record.origin       = pev->origin;
+	record.angles       = pev->angles;
+	record.mins         = pev->mins;
+	record.maxs         = pev->maxs;
+	record.sequence     = pev->sequence;
+	record.frame        = pev->frame;
+	record.framerate    = pev->framerate;
+	record.animtime     = pev->animtime;
+	record.gaitsequence = pPlayer->m_iGaitsequence;
+	record.gaitframe    = pPlayer->m_flGaitframe;
+	record.gaityaw      = pPlayer->m_flGaityaw;
+
+	memcpy(record.controller, pev->controller, sizeof(record.controller));
+	memcpy(record.blending, pev->blending, sizeof(record.blending));
+}
+
+void CLagCompensation::Apply(CBasePlayer *pPlayer, const lagrecord_t &record)
+{
+	entvars_t *pev = pPlayer->pev;
+
+	pev->angles    = record.angles;
+	pev->mins      = record.mins;
+	pev->maxs      = record.maxs;
+	pev->sequence  = record.sequence;
+	pev->frame     = record.frame;
+	pev->framerate = record.framerate;
+	pev->animtime  = record.animtime;
+
+	pPlayer->m_iGaitsequence = record.gaitsequence;
+	pPlayer->m_flGaitframe   = record.gaitframe;
+	pPlayer->m_flGaityaw     = record.gaityaw;
+
+	memcpy(pev->controller, record.controller, sizeof(record.controller));
+	memcpy(pev->blending, record.blending, sizeof(record.blending));
+
+	// relinks the edict with the new bounds
+	SET_ORIGIN(pPlayer->edict(), record.origin);
+}
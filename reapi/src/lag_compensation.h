@@ -0,0 +1,70 @@
+#pragma once
+
+#define LAGCOMP_MAX_RECORDS  256   // upper bound of the history length per player
+#define LAGCOMP_MAX_UNLAG    1.0f  // never rewind further than this, in seconds
+
+// Everything a trace against a player depends on
+struct lagrecord_t
+{
+	float time;
+	Vector origin;
+	Vector angles;
+	Vector mins;
+	Vector maxs;
+	int sequence;
+	float frame;
+	float framerate;
+	float animtime;
+	byte controller[4];
+	byte blending[2];
+	int gaitsequence;
+	float gaitframe;
+	float gaityaw;
+};
+
+// Per-player history of the states used by traces, recorded every server frame.
+// Players can be moved back to the time a client saw them, traced against and moved back
+// before the caller returns.
+class CLagCompensation
+{
+public:
+	// Sets the amount of records kept per player, 0 disables the recording
+	void SetHistory(int numRecords);
+	int GetHistory() const { return m_numRecords; }
+
+	// Called once per server frame
+	void Record();
+
+	// Moves all other players to the given time, returns the amount of moved players
+	int Rewind(int client, float flTargetTime);
+	void Restore();
+
+	bool IsRewound() const { return m_rewound; }
+
+	// Time the client saw the world at, based on its latency and interpolation
+	static float GetViewTime(int client);
+
+	void Clear();
+
+private:
+	struct history_t
+	{
+		std::vector<lagrecord_t> records;
+		int head;   // next record to write
+		int count;
+	};
+
+	static void Save(CBasePlayer *pPlayer, lagrecord_t &record);
+	static void Apply(CBasePlayer *pPlayer, const lagrecord_t &record);
+
+	bool Lookup(int index, float flTargetTime, lagrecord_t &result) const;
+
+	int m_numRecords = 0;
+	bool m_rewound = false;
+
+	history_t m_history[MAX_CLIENTS + 1];
+	lagrecord_t m_backup[MAX_CLIENTS + 1];
+	bool m_moved[MAX_CLIENTS + 1];
+};
+
+extern CLagCompensation g_lagCompensation;
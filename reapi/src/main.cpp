@@ -52,6 +52,18 @@ void OnMetaDetach()
 
 	if (api_cfg.hasReGameDLL()) {
 		g_ReGameHookchains->InstallGameRules()->unregisterHook(&InstallGameRules);
+		g_voiceMatrix.Clear();
+	}
+
+	if (api_cfg.hasReHLDS()) {
+		g_packetLimiter.Clear();
+		g_stringCmdLimiter.Clear();
+		g_userInfoRules.Clear();
+		g_pingOverrides.Clear();
+		g_soundCulling.Clear();
+		g_soundRemap.Clear();
+		g_eventFilter.Clear();
+		g_messageDeferral.Clear();
 	}
 }
 
@@ -72,6 +84,23 @@ void ServerDeactivate_Post()
 	g_messageHookManager.Clear();
 	g_queryFileManager.Clear();
 	EntityCallbackDispatcher().DeleteAllCallbacks();
+	g_playerSnapshot.Invalidate();
+	g_boneCache.Clear();
+	g_studioCache.Clear();
+	g_lagCompensation.Clear();
+	g_timerWheel.Clear();
+	g_jobScheduler.Clear();
+	g_entityData.Clear();
+	g_entityPool.Clear();
+	g_entityRemoval.Clear();
+	g_userInfoRules.Clear();
+	g_pingOverrides.Clear();
+	g_soundCulling.Clear();
+	g_soundRemap.Clear();
+	g_eventFilter.Clear();
+	g_netMetrics.Clear();
+	g_messageDeferral.Clear();
+	g_voiceMatrix.Clear();
 
 	g_pFunctionTable->pfnSpawn = DispatchSpawn;
 	g_pFunctionTable->pfnKeyValue = KeyValue;
@@ -79,6 +108,24 @@ void ServerDeactivate_Post()
 	SET_META_RESULT(MRES_IGNORED);
 }
 
+void StartFrame()
+{
+	// deliver post hooks queued during the previous frame
+	g_hookManager.DispatchDeferred();
+
+	// remove the entities queued during the previous frame
+	g_entityRemoval.Flush();
+
+	g_playerSnapshot.Invalidate();
+	g_lagCompensation.Record();
+	g_timerWheel.Advance();
+	g_jobScheduler.RunFrame();
+	g_netMetrics.Sample();
+	g_messageDeferral.Flush();
+
+	SET_META_RESULT(MRES_IGNORED);
+}
+
 void KeyValue(edict_t *pentKeyvalue, KeyValueData *pkvd)
 {
 	// get the first edict worldspawn
@@ -142,6 +189,15 @@ void OnFreeEntPrivateData(edict_t *pEdict)
 		return;
 	}
 
-	EntityCallbackDispatcher().DeleteExistingCallbacks(pEntity);
+	const int index = indexOfEdict(pEdict);
+
+	// the removal queue already dropped the callbacks of its entities in bulk
+	if (!g_entityRemoval.IsFlushing(index))
+		EntityCallbackDispatcher().DeleteExistingCallbacks(pEntity);
+
+	g_timerWheel.OnEntityFreed(index);
+	g_entityData.OnEntityFreed(index);
+	g_entityPool.OnEntityFreed(index);
+	g_entityRemoval.OnEntityFreed(index);
 	SET_META_RESULT(MRES_IGNORED);
 }
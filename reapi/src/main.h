@@ -16,6 +16,7 @@ void OnMetaDetach();
 void OnFreeEntPrivateData(edict_t *pEdict);
 void ServerActivate_Post(edict_t *pEdictList, int edictCount, int clientMax);
 void ServerDeactivate_Post();
+void StartFrame();
 int DispatchSpawn(edict_t* pEntity);
 void ResetGlobalState();
 void KeyValue(edict_t *pentKeyvalue, KeyValueData *pkvd);
@@ -0,0 +1,278 @@
+#include "precompiled.h"
+
+CMessageDeferral g_messageDeferral;
+
+CMessageDeferral::CMessageDeferral()
+{
+	for (auto &priority : m_priority)
+		priority = MSG_PRIORITY_CRITICAL;
+
+	for (auto &queue : m_queues)
+	{
+		queue.userid = 0;
+		memset(&queue.stats, 0, sizeof(queue.stats));
+	}
+}
+
+void CMessageDeferral::SetPriority(int msg_id, MessagePriority priority)
+{
+	if (m_priority[msg_id] == priority)
+		return;
+
+	// the lowest priority runs after the plugin hooks, which may change the message or its receiver
+	if (priority == MSG_PRIORITY_LOW)
+		g_RehldsMessageManager->registerHook(msg_id, OnMessage, HC_PRIORITY_LOW);
+	else
+		g_RehldsMessageManager->unregisterHook(msg_id, OnMessage);
+
+	m_priority[msg_id] = priority;
+}
+
+void CMessageDeferral::SetLimits(float reliableFill, float maxDelay)
+{
+	m_reliableFill = clamp(reliableFill, 0.0f, 1.0f);
+	m_maxDelay = max(maxDelay, 0.0f);
+}
+
+bool CMessageDeferral::IsChoking(const client_t *pClient) const
+{
+	const netchan_t &chan = pClient->netchan;
+
+	if (chan.remote_address.type == NA_LOOPBACK)
+		return false;
+
+	// the rate of the client didn't let the last update go out,
+	// cleartime alone is past realtime after most packets of a rate limited client
+	if (pClient->chokecount > 0)
+		return true;
+
+	return chan.message.cursize > chan.message.maxsize * m_reliableFill;
+}
+
+void CMessageDeferral::Defer(queue_t &queue, IMessage *message)
+{
+	const int id = message->getId();
+
+	deferred_t *msg = nullptr;
+	for (auto &queued : queue.messages)
+	{
+		if (queued.id == id)
+		{
+			msg = &queued;
+			break;
+		}
+	}
+
+	if (msg)
+	{
+		// last wins
+		queue.stats.coalesced++;
+	}
+	else
+	{
+		if (queue.messages.size() >= MSG_DEFER_QUEUE_MAX)
+		{
+			queue.messages.erase(queue.messages.begin());
+			queue.stats.dropped++;
+			m_numQueued--;
+		}
+
+		queue.messages.emplace_back();
+		queue.stats.deferred++;
+		m_numQueued++;
+
+		msg = &queue.messages.back();
+		msg->id = id;
+	}
+
+	msg->dest = message->getDest();
+	msg->time = g_RehldsFuncs->GetRealTime();
+	msg->params.resize(message->getParamCount());
+	msg->strings.clear();
+
+	for (size_t i = 0; i < msg->params.size(); i++)
+	{
+		param_t &param = msg->params[i];
+		param.type = message->getParamType(i);
+
+		switch (param.type)
+		{
+		case IMessage::ParamType::Angle:
+		case IMessage::ParamType::Coord:
+			param.flValue = message->getParamFloat(i);
+			break;
+		case IMessage::ParamType::String:
+		{
+			const char *string = message->getParamString(i);
+			param.string = msg->strings.size();
+			msg->strings.insert(msg->strings.end(), string, string + Q_strlen(string) + 1);
+			break;
+		}
+		default:
+			param.iValue = message->getParamInt(i);
+			break;
+		}
+	}
+}
+
+void CMessageDeferral::Send(edict_t *pEdict, const deferred_t &msg)
+{
+	m_sending = true;
+
+	EMESSAGE_BEGIN((int)msg.dest, msg.id, nullptr, pEdict);
+
+	for (auto &param : msg.params)
+	{
+		switch (param.type)
+		{
+		case IMessage::ParamType::Byte:   EWRITE_BYTE(param.iValue);                break;
+		case IMessage::ParamType::Char:   EWRITE_CHAR(param.iValue);                break;
+		case IMessage::ParamType::Short:  EWRITE_SHORT(param.iValue);               break;
+		case IMessage::ParamType::Long:   EWRITE_LONG(param.iValue);                break;
+		case IMessage::ParamType::Angle:  EWRITE_ANGLE(param.flValue);              break;
+		case IMessage::ParamType::Coord:  EWRITE_COORD(param.flValue);              break;
+		case IMessage::ParamType::String: EWRITE_STRING(&msg.strings[param.string]); break;
+		case IMessage::ParamType::Entity: EWRITE_ENTITY(param.iValue);              break;
+		}
+	}
+
+	EMESSAGE_END();
+
+	m_sending = false;
+}
+
+void CMessageDeferral::Flush()
+{
+	if (!m_numQueued)
+		return;
+
+	const double now = g_RehldsFuncs->GetRealTime();
+
+	const int maxClients = min(gpGlobals->maxClients, MAX_CLIENTS);
+	for (int i = 0; i < maxClients; i++)
+	{
+		queue_t &queue = m_queues[i];
+		if (queue.messages.empty())
+			continue;
+
+		client_t *pClient = g_RehldsSvs->GetClient_t(i);
+
+		// the client has left
+		if (!pClient->active || pClient->userid != queue.userid)
+		{
+			m_numQueued -= queue.messages.size();
+			queue.messages.clear();
+			continue;
+		}
+
+		size_t sent = 0;
+		for (auto &msg : queue.messages)
+		{
+			if (msg.time + m_maxDelay < now)
+			{
+				queue.stats.dropped++;
+				sent++;
+				continue;
+			}
+
+			if (IsChoking(pClient))
+				break;
+
+			Send(pClient->edict, msg);
+			queue.stats.flushed++;
+			sent++;
+		}
+
+		queue.messages.erase(queue.messages.begin(), queue.messages.begin() + sent);
+		m_numQueued -= sent;
+	}
+}
+
+int CMessageDeferral::GetStats(int index, uint32 &deferred, uint32 &coalesced, uint32 &flushed, uint32 &dropped) const
+{
+	deferred = coalesced = flushed = dropped = 0;
+
+	int queued = 0;
+	for (int i = (index ? index - 1 : 0); i < (index ? index : MAX_CLIENTS); i++)
+	{
+		const queue_t &queue = m_queues[i];
+
+		deferred  += queue.stats.deferred;
+		coalesced += queue.stats.coalesced;
+		flushed   += queue.stats.flushed;
+		dropped   += queue.stats.dropped;
+		queued    += queue.messages.size();
+	}
+
+	return queued;
+}
+
+void CMessageDeferral::ResetStats()
+{
+	for (auto &queue : m_queues)
+		memset(&queue.stats, 0, sizeof(queue.stats));
+}
+
+void CMessageDeferral::Clear()
+{
+	for (int id = 0; id < MAX_USERMESSAGES; id++)
+		SetPriority(id, MSG_PRIORITY_CRITICAL);
+
+	for (auto &queue : m_queues)
+		queue.messages.clear();
+
+	m_numQueued = 0;
+}
+
+void CMessageDeferral::OnMessage(IVoidHookChain<IMessage *> *chain, IMessage *message)
+{
+	CMessageDeferral &self = g_messageDeferral;
+
+	const IMessage::Dest dest = message->getDest();
+	if (self.m_sending || (dest != IMessage::Dest::ONE && dest != IMessage::Dest::ONE_UNRELIABLE))
+	{
+		chain->callNext(message);
+		return;
+	}
+
+	const int index = indexOfEdict(message->getEdict());
+	if (index <= 0 || index > gpGlobals->maxClients)
+	{
+		chain->callNext(message);
+		return;
+	}
+
+	client_t *pClient = clientOfIndex(index);
+	if (!pClient->active || pClient->fakeclient)
+	{
+		chain->callNext(message);
+		return;
+	}
+
+	queue_t &queue = self.m_queues[index - 1];
+	if (queue.userid != pClient->userid)
+	{
+		self.m_numQueued -= queue.messages.size();
+		queue.messages.clear();
+		queue.userid = pClient->userid;
+	}
+
+	bool pending = false;
+	for (auto &queued : queue.messages)
+	{
+		if (queued.id == message->getId())
+		{
+			pending = true;
+			break;
+		}
+	}
+
+	// a queued message of the same id would be sent after this one
+	if (!pending && !self.IsChoking(pClient))
+	{
+		chain->callNext(message);
+		return;
+	}
+
+	self.Defer(queue, message);
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#define MSG_DEFER_QUEUE_MAX     32      // messages queued per client, the oldest one is dropped beyond
+
+// priority classes of user messages
+enum MessagePriority
+{
+	MSG_PRIORITY_CRITICAL = 0,  // always sent right away
+	MSG_PRIORITY_LOW,           // deferred while the client is choking
+};
+
+// Defers the low priority messages sent to a single client (MSG_ONE, MSG_ONE_UNRELIABLE) while its channel is choking,
+// so that plugin HUD messages don't push game critical data out of the reliable buffer.
+// The queue keeps the last message of every id and is flushed when the channel has room again.
+class CMessageDeferral
+{
+public:
+	CMessageDeferral();
+
+	void SetPriority(int msg_id, MessagePriority priority);
+	MessagePriority GetPriority(int msg_id) const { return m_priority[msg_id]; }
+
+	// reliableFill is the fraction of the reliable buffer from which the client is considered choking,
+	// the queued messages older than maxDelay seconds are dropped
+	void SetLimits(float reliableFill, float maxDelay);
+
+	// Sends the queued messages of the clients with room in their channel, called every frame
+	void Flush();
+
+	// Counters of the client, or totals of all clients if index is 0. Returns the amount of queued messages.
+	int GetStats(int index, uint32 &deferred, uint32 &coalesced, uint32 &flushed, uint32 &dropped) const;
+	void ResetStats();
+
+	// Resets the priorities, drops the queues and unregisters the message hooks
+	void Clear();
+
+private:
+	static void OnMessage(IVoidHookChain<IMessage *> *chain, IMessage *message);
+
+	struct param_t
+	{
+		IMessage::ParamType type;
+		int iValue;
+		float flValue;
+		size_t string;      // offset in the string pool of the message
+	};
+
+	struct deferred_t
+	{
+		int id;
+		IMessage::Dest dest;
+		double time;
+		std::vector<param_t> params;
+		std::vector<char> strings;
+	};
+
+	struct stats_t
+	{
+		uint32 deferred;
+		uint32 coalesced;
+		uint32 flushed;
+		uint32 dropped;     // expired or pushed out of a full queue
+	};
+
+	struct queue_t
+	{
+		int userid;
+		std::vector<deferred_t> messages;
+		stats_t stats;
+	};
+
+	bool IsChoking(const client_t *pClient) const;
+	void Defer(queue_t &queue, IMessage *message);
+	void Send(edict_t *pEdict, const deferred_t &msg);
+
+	MessagePriority m_priority[MAX_USERMESSAGES];
+	queue_t m_queues[MAX_CLIENTS];
+	size_t m_numQueued = 0;
+
+	float m_reliableFill = 0.75f;
+	float m_maxDelay = 2.0f;
+
+	// set while the queued messages are sent, they go through the hook again
+	bool m_sending = false;
+};
+
+extern CMessageDeferral g_messageDeferral;
@@ -312,6 +312,274 @@ cell AMX_NATIVE_CALL amx_GetAttachment(AMX *amx, cell *params)
 	return TRUE;
 }
 
+/*
+* Gets the positions of all bones of the entity in one call
+*
+* @param entity     Entity index
+* @param vecOrigins Array to store origins in, 3 cells per bone
+* @param maxBones   Maximum amount of bones to store
+*
+* @return           Amount of bones stored
+* @error            If the index is not within the range of 1 to maxEntities or
+*                   the entity is not valid, an error will be thrown.
+*
+* native GetAllBonePositions(const entity, Float:vecOrigins[], const maxBones);
+*/
+cell AMX_NATIVE_CALL amx_GetAllBonePositions(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_index, arg_origins, arg_maxbones };
+
+	CHECK_ISENTITY(arg_index);
+
+	CBaseEntity *pEntity = getPrivate<CBaseEntity>(params[arg_index]);
+	if (unlikely(pEntity == nullptr)) {
+		AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: invalid or uninitialized entity", __FUNCTION__);
+		return FALSE;
+	}
+
+	if (FNullEnt(params[arg_index])) {
+		AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: worldspawn not allowed", __FUNCTION__);
+		return FALSE;
+	}
+
+	studiohdr_t *pstudiohdr = static_cast<studiohdr_t *>(GET_MODEL_PTR(pEntity->edict()));
+	if (!pstudiohdr)
+		return 0;
+
+	Vector *pVecOrigins = (Vector *)getAmxAddr(amx, params[arg_origins]);
+	int numBones = clamp(params[arg_maxbones], 0, pstudiohdr->numbones);
+
+	const bonecache_t *pCache = g_boneCache.Get(pEntity);
+	for (int i = 0; i < numBones; i++)
+	{
+		if (pCache)
+			CBoneCache::GetBoneOrigin(pCache, i, pVecOrigins[i]);
+		else
+			GetBonePosition(pEntity, i, &pVecOrigins[i], nullptr);
+	}
+
+	return numBones;
+}
+
+/*
+* Gets the positions of the listed bones of the entity in one call
+*
+* @param entity     Entity index
+* @param bones      Array of bone numbers
+* @param numBones   Amount of bones in the array
+* @param vecOrigins Array to store origins in, 3 cells per bone in the order of the list
+*
+* @return           1 on success, 0 otherwise
+* @error            If the index is not within the range of 1 to maxEntities or
+*                   the entity is not valid, an error will be thrown.
+*
+* native GetBonePositions(const entity, const bones[], const numBones, Float:vecOrigins[]);
+*/
+cell AMX_NATIVE_CALL amx_GetBonePositions(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_index, arg_bones, arg_numbones, arg_origins };
+
+	CHECK_ISENTITY(arg_index);
+
+	CBaseEntity *pEntity = getPrivate<CBaseEntity>(params[arg_index]);
+	if (unlikely(pEntity == nullptr)) {
+		AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: invalid or uninitialized entity", __FUNCTION__);
+		return FALSE;
+	}
+
+	if (FNullEnt(params[arg_index])) {
+		AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: worldspawn not allowed", __FUNCTION__);
+		return FALSE;
+	}
+
+	studiohdr_t *pstudiohdr = static_cast<studiohdr_t *>(GET_MODEL_PTR(pEntity->edict()));
+	if (!pstudiohdr)
+		return FALSE;
+
+	cell *pBones = getAmxAddr(amx, params[arg_bones]);
+	Vector *pVecOrigins = (Vector *)getAmxAddr(amx, params[arg_origins]);
+	int numBones = params[arg_numbones];
+
+	for (int i = 0; i < numBones; i++)
+	{
+		if (pBones[i] < 0 || pBones[i] >= pstudiohdr->numbones) {
+			AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: invalid bone %d at position %d", __FUNCTION__, pBones[i], i);
+			return FALSE;
+		}
+	}
+
+	const bonecache_t *pCache = g_boneCache.Get(pEntity);
+	for (int i = 0; i < numBones; i++)
+	{
+		if (pCache)
+			CBoneCache::GetBoneOrigin(pCache, pBones[i], pVecOrigins[i]);
+		else
+			GetBonePosition(pEntity, pBones[i], &pVecOrigins[i], nullptr);
+	}
+
+	return TRUE;
+}
+
+/*
+* Gets the positions of all attachments of the entity in one call
+*
+* @param entity         Entity index
+* @param vecOrigins     Array to store origins in, 3 cells per attachment
+* @param maxAttachments Maximum amount of attachments to store
+*
+* @return               Amount of attachments stored
+* @error                If the index is not within the range of 1 to maxEntities or
+*                       the entity is not valid, an error will be thrown.
+*
+* native GetAllAttachments(const entity, Float:vecOrigins[], const maxAttachments);
+*/
+cell AMX_NATIVE_CALL amx_GetAllAttachments(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_index, arg_origins, arg_maxattachments };
+
+	CHECK_ISENTITY(arg_index);
+
+	CBaseEntity *pEntity = getPrivate<CBaseEntity>(params[arg_index]);
+	if (unlikely(pEntity == nullptr)) {
+		AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: invalid or uninitialized entity", __FUNCTION__);
+		return FALSE;
+	}
+
+	if (FNullEnt(params[arg_index])) {
+		AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: worldspawn not allowed", __FUNCTION__);
+		return FALSE;
+	}
+
+	studiohdr_t *pstudiohdr = static_cast<studiohdr_t *>(GET_MODEL_PTR(pEntity->edict()));
+	if (!pstudiohdr)
+		return 0;
+
+	Vector *pVecOrigins = (Vector *)getAmxAddr(amx, params[arg_origins]);
+	int numAttachments = clamp(params[arg_maxattachments], 0, pstudiohdr->numattachments);
+
+	const mstudioattachment_t *pattachments = (mstudioattachment_t *)((byte *)pstudiohdr + pstudiohdr->attachmentindex);
+	const bonecache_t *pCache = g_boneCache.Get(pEntity);
+
+	for (int i = 0; i < numAttachments; i++)
+	{
+		if (pCache && pattachments[i].bone >= 0 && pattachments[i].bone < pCache->numbones)
+			CBoneCache::GetAttachmentOrigin(pCache, i, pVecOrigins[i]);
+		else
+			GetAttachment(pEntity, i, &pVecOrigins[i], nullptr);
+	}
+
+	return numAttachments;
+}
+
+/*
+* Intersects a ray with the hitboxes of the listed entities
+*
+* @param vecStart     Start of the ray
+* @param vecEnd       End of the ray
+* @param entities     Array of entity indexes to test
+* @param numEntities  Amount of entities in the array
+* @param hits         Array to store hits in, HITBOX_HIT_CELLS cells per hit
+* @param maxHits      Maximum amount of hits to store
+* @param allHitboxes  If true every hitbox crossed by the ray is stored,
+*                     otherwise only the nearest one of each entity
+*
+* @return             Amount of hits stored, sorted by distance from the start of the ray
+* @error              If any index is not within the range of 1 to maxEntities, an error will be thrown.
+*
+* native TraceHitboxes(const Float:vecStart[3], const Float:vecEnd[3], const entities[], const numEntities, any:hits[], const maxHits, const bool:allHitboxes = false);
+*/
+cell AMX_NATIVE_CALL amx_TraceHitboxes(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_start, arg_end, arg_entities, arg_numentities, arg_hits, arg_maxhits, arg_allhitboxes };
+	enum hit_cells_e { hit_entity, hit_group, hit_bone, hit_distance, hit_cells };
+
+	struct hitboxhit_t
+	{
+		int entity;
+		int group;
+		int bone;
+		float distance;
+	};
+
+	static std::vector<hitboxhit_t> hits;
+	hits.clear();
+
+	Vector vecStart = *(Vector *)getAmxAddr(amx, params[arg_start]);
+	Vector vecDir = *(Vector *)getAmxAddr(amx, params[arg_end]) - vecStart;
+
+	float flMaxDist = vecDir.Length();
+	if (flMaxDist <= 0.0f)
+		return 0;
+
+	vecDir = vecDir / flMaxDist;
+
+	cell *pEntities = getAmxAddr(amx, params[arg_entities]);
+	bool allHitboxes = params[arg_allhitboxes] != 0;
+
+	for (int i = 0; i < params[arg_numentities]; i++)
+	{
+		int index = pEntities[i];
+		if (unlikely(index <= 0 || index > gpGlobals->maxEntities)) {
+			AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: invalid entity index %i at position %d", __FUNCTION__, index, i);
+			return FALSE;
+		}
+
+		edict_t *pEdict = edictByIndex(index);
+		CBaseEntity *pEntity = getPrivate<CBaseEntity>(index);
+		if (!pEntity || pEdict->free)
+			continue;
+
+		// same as the engine, don't bother with the skeleton if the absolute box is missed
+		float flDist;
+		if (!CBoneCache::IntersectBox(vecStart, vecDir, flMaxDist, pEdict->v.absmin, pEdict->v.absmax, flDist))
+			continue;
+
+		const bonecache_t *pCache = g_boneCache.Get(pEntity);
+		if (!pCache)
+			continue;
+
+		const studiohdr_t *pstudiohdr = pCache->pose.pstudiohdr;
+		const mstudiobbox_t *pbox = (const mstudiobbox_t *)((const byte *)pstudiohdr + pstudiohdr->hitboxindex);
+
+		hitboxhit_t nearest = { 0, 0, 0, flMaxDist };
+		for (int j = 0; j < pstudiohdr->numhitboxes; j++, pbox++)
+		{
+			if (pbox->bone < 0 || pbox->bone >= pCache->numbones)
+				continue;
+
+			if (!CBoneCache::IntersectHitbox(pCache, pbox, vecStart, vecDir, flMaxDist, flDist))
+				continue;
+
+			hitboxhit_t hit = { index, pbox->group, pbox->bone, flDist };
+
+			if (allHitboxes)
+				hits.push_back(hit);
+			else if (!nearest.entity || flDist < nearest.distance)
+				nearest = hit;
+		}
+
+		if (nearest.entity)
+			hits.push_back(nearest);
+	}
+
+	std::sort(hits.begin(), hits.end(), [](const hitboxhit_t &a, const hitboxhit_t &b) {
+		return a.distance < b.distance;
+	});
+
+	int numHits = clamp((int)hits.size(), 0, params[arg_maxhits]);
+	cell *pHits = getAmxAddr(amx, params[arg_hits]);
+
+	for (int i = 0; i < numHits; i++, pHits += hit_cells)
+	{
+		pHits[hit_entity]   = hits[i].entity;
+		pHits[hit_group]    = hits[i].group;
+		pHits[hit_bone]     = hits[i].bone;
+		pHits[hit_distance] = amx_FloatToCell(hits[i].distance);
+	}
+
+	return numHits;
+}
+
 /*
 * Sets body group value based on entity's model group
 *
@@ -413,6 +681,134 @@ cell AMX_NATIVE_CALL amx_GetSequenceInfo(AMX *amx, cell *params)
 	return (cell)GetSequenceInfo2(pEntity, pflags, pframerate, pgroundspeed);
 }
 
+/*
+* Looks up the index of the sequence by name in the entity's model
+*
+* @param entity     Entity index
+* @param name       Sequence name, case insensitive
+*
+* @return           Sequence index, -1 if the model has no such sequence
+* @error            If the index is not within the range of 1 to maxEntities or
+*                   the entity is not valid, an error will be thrown.
+*
+* native LookupSequence(const entity, const name[]);
+*/
+cell AMX_NATIVE_CALL amx_LookupSequence(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_index, arg_name };
+
+	CHECK_ISENTITY(arg_index);
+
+	edict_t *pEdict = edictByIndexAmx(params[arg_index]);
+	if (unlikely(pEdict == nullptr)) {
+		AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: invalid or uninitialized entity", __FUNCTION__);
+		return -1;
+	}
+
+	const CStudioModelInfo *pInfo = g_studioCache.Get(pEdict);
+	if (!pInfo)
+		return -1;
+
+	char name[64];
+	return pInfo->Lookup(SNT_SEQUENCE, getAmxString(amx, params[arg_name], name));
+}
+
+/*
+* Looks up the index of the bone by name in the entity's model
+*
+* @param entity     Entity index
+* @param name       Bone name, case insensitive
+*
+* @return           Bone index, -1 if the model has no such bone
+* @error            If the index is not within the range of 1 to maxEntities or
+*                   the entity is not valid, an error will be thrown.
+*
+* native LookupBone(const entity, const name[]);
+*/
+cell AMX_NATIVE_CALL amx_LookupBone(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_index, arg_name };
+
+	CHECK_ISENTITY(arg_index);
+
+	edict_t *pEdict = edictByIndexAmx(params[arg_index]);
+	if (unlikely(pEdict == nullptr)) {
+		AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: invalid or uninitialized entity", __FUNCTION__);
+		return -1;
+	}
+
+	const CStudioModelInfo *pInfo = g_studioCache.Get(pEdict);
+	if (!pInfo)
+		return -1;
+
+	char name[64];
+	return pInfo->Lookup(SNT_BONE, getAmxString(amx, params[arg_name], name));
+}
+
+/*
+* Looks up the index of the attachment by name in the entity's model
+*
+* @param entity     Entity index
+* @param name       Attachment name, case insensitive
+*
+* @return           Attachment index, -1 if the model has no such attachment
+* @error            If the index is not within the range of 1 to maxEntities or
+*                   the entity is not valid, an error will be thrown.
+*
+* native LookupAttachment(const entity, const name[]);
+*/
+cell AMX_NATIVE_CALL amx_LookupAttachment(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_index, arg_name };
+
+	CHECK_ISENTITY(arg_index);
+
+	edict_t *pEdict = edictByIndexAmx(params[arg_index]);
+	if (unlikely(pEdict == nullptr)) {
+		AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: invalid or uninitialized entity", __FUNCTION__);
+		return -1;
+	}
+
+	const CStudioModelInfo *pInfo = g_studioCache.Get(pEdict);
+	if (!pInfo)
+		return -1;
+
+	char name[64];
+	return pInfo->Lookup(SNT_ATTACHMENT, getAmxString(amx, params[arg_name], name));
+}
+
+/*
+* Looks up the index of the bodygroup by name in the entity's model
+*
+* @param entity     Entity index
+* @param name       Bodygroup name, case insensitive
+*
+* @return           Bodygroup index, -1 if the model has no such bodygroup
+* @error            If the index is not within the range of 1 to maxEntities or
+*                   the entity is not valid, an error will be thrown.
+*
+* native LookupBodygroup(const entity, const name[]);
+*/
+cell AMX_NATIVE_CALL amx_LookupBodygroup(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_index, arg_name };
+
+	CHECK_ISENTITY(arg_index);
+
+	edict_t *pEdict = edictByIndexAmx(params[arg_index]);
+	if (unlikely(pEdict == nullptr)) {
+		AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: invalid or uninitialized entity", __FUNCTION__);
+		return -1;
+	}
+
+	const CStudioModelInfo *pInfo = g_studioCache.Get(pEdict);
+	if (!pInfo)
+		return -1;
+
+	char name[64];
+	return pInfo->Lookup(SNT_BODYGROUP, getAmxString(amx, params[arg_name], name));
+}
+
 /*
 * Sets Think callback for entity
 *
@@ -634,6 +1030,105 @@ cell AMX_NATIVE_CALL amx_SetMoveDone(AMX *amx, cell *params)
 	return (cell)EntityCallbackDispatcher().SetMoveDone(amx, pEntity, funcname, pParams, params[arg_len]);
 }
 
+/*
+* Creates a timer, it's fired from the start of the server frame
+*
+* @param delay      Time in seconds until the callback is called, resolution is 0.01 second
+* @param callback   The forward to call
+* @param entity     Optional entity to bind the timer to, the timer is killed when the entity is removed
+* @param repeat     If true, the timer is fired every delay seconds until it's killed
+* @param params     Optional set of data to pass through to callback
+* @param len        Optional size of data
+*
+* @note Callback should be contains passing arguments as "public Timer_Callback(const timer, const entity)"
+*       or "public Timer_Callback(const timer, const entity, const params[])" if params are passed
+*
+* @return           Timer handle, 0 on failure
+*
+* native CreateTimer(const Float:delay, const callback[], const entity = 0, const bool:repeat = false, const params[] = "", const len = 0);
+*/
+cell AMX_NATIVE_CALL amx_CreateTimer(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_delay, arg_handler, arg_index, arg_repeat, arg_params, arg_len };
+
+	CHECK_ISENTITY(arg_index);
+
+	if (params[arg_index] > 0 && getPrivate<CBaseEntity>(params[arg_index]) == nullptr) {
+		AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: invalid or uninitialized entity", __FUNCTION__);
+		return FALSE;
+	}
+
+	char namebuf[256];
+	const char *funcname = getAmxString(amx, params[arg_handler], namebuf);
+
+	int funcid;
+	if (unlikely(g_amxxapi.amx_FindPublic(amx, funcname, &funcid) != AMX_ERR_NONE)) {
+		AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: public function \"%s\" not found.", __FUNCTION__, funcname);
+		return FALSE;
+	}
+
+	float flDelay = CAmxArg(amx, params[arg_delay]);
+	cell *pParams = (PARAMS_COUNT >= 5) ? getAmxAddr(amx, params[arg_params]) : nullptr;
+	size_t iParamsLen = (PARAMS_COUNT >= 6) ? params[arg_len] : 0;
+
+	int handle = g_timerWheel.Schedule(amx, funcname, flDelay, params[arg_repeat] != 0, params[arg_index], pParams, iParamsLen);
+	if (unlikely(!handle)) {
+		AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: failed to create timer.", __FUNCTION__);
+		return FALSE;
+	}
+
+	return handle;
+}
+
+/*
+* Kills a timer
+*
+* @param timer      Timer handle
+*
+* @return           true if the timer was active, false otherwise
+*
+* native bool:KillTimer(const timer);
+*/
+cell AMX_NATIVE_CALL amx_KillTimer(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_timer };
+
+	return g_timerWheel.Cancel(params[arg_timer]) ? TRUE : FALSE;
+}
+
+/*
+* Checks if a timer is active
+*
+* @param timer      Timer handle
+*
+* @return           true if the timer will still fire, false otherwise
+*
+* native bool:TimerExists(const timer);
+*/
+cell AMX_NATIVE_CALL amx_TimerExists(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_timer };
+
+	return g_timerWheel.IsActive(params[arg_timer]) ? TRUE : FALSE;
+}
+
+/*
+* Gets the time left until a timer fires
+*
+* @param timer      Timer handle
+*
+* @return           Time left in seconds, -1.0 if the timer isn't active
+*
+* native Float:GetTimerTimeLeft(const timer);
+*/
+cell AMX_NATIVE_CALL amx_GetTimerTimeLeft(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_timer };
+
+	float flTimeLeft = g_timerWheel.GetTimeLeft(params[arg_timer]);
+	return *(cell *)&flTimeLeft;
+}
+
 enum class CheckVisibilityType {
 	PVS = 0, // Check in Potentially Visible Set (PVS)
 	PAS      // Check in Potentially Audible Set (PAS)
@@ -686,6 +1181,445 @@ cell AMX_NATIVE_CALL amx_CheckVisibilityInOrigin(AMX *amx, cell *params)
 	return ENGINE_CHECK_VISIBILITY(pEntity->edict(), pSet);
 }
 
+/*
+* Starts a job that is called from the start of every server frame until it's done
+*
+* @param callback   The forward to call
+* @param budget     Time in microseconds the job may use per frame, it's called repeatedly until the budget is spent
+* @param params     Optional set of data to pass through to callback, changes made by the callback are kept between calls
+* @param len        Optional size of data
+*
+* @note Callback should be contains passing arguments as "public Job_Callback(const job, const iteration)"
+*       or "public Job_Callback(const job, const iteration, params[])" if params are passed,
+*       and return JOB_CONTINUE or JOB_DONE
+*
+* @return           Job id, 0 on failure
+*
+* native StartJob(const callback[], const budget = 1000, const params[] = "", const len = 0);
+*/
+cell AMX_NATIVE_CALL amx_StartJob(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_handler, arg_budget, arg_params, arg_len };
+
+	char namebuf[256];
+	const char *funcname = getAmxString(amx, params[arg_handler], namebuf);
+
+	int funcid;
+	if (unlikely(g_amxxapi.amx_FindPublic(amx, funcname, &funcid) != AMX_ERR_NONE)) {
+		AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: public function \"%s\" not found.", __FUNCTION__, funcname);
+		return FALSE;
+	}
+
+	if (params[arg_budget] <= 0 || params[arg_budget] > JOB_MAX_BUDGET) {
+		AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: invalid budget %d, must be between 1 and %d microseconds", __FUNCTION__, params[arg_budget], JOB_MAX_BUDGET);
+		return FALSE;
+	}
+
+	cell *pParams = (PARAMS_COUNT >= 3) ? getAmxAddr(amx, params[arg_params]) : nullptr;
+	size_t iParamsLen = (PARAMS_COUNT >= 4) ? params[arg_len] : 0;
+
+	int id = g_jobScheduler.Start(amx, funcname, params[arg_budget], pParams, iParamsLen);
+	if (unlikely(!id)) {
+		AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: failed to register forward.", __FUNCTION__);
+		return FALSE;
+	}
+
+	return id;
+}
+
+/*
+* Stops a job, it isn't called anymore
+*
+* @param job        Job id
+*
+* @return           true if the job was running, false otherwise
+*
+* native bool:StopJob(const job);
+*/
+cell AMX_NATIVE_CALL amx_StopJob(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_job };
+
+	return g_jobScheduler.Stop(params[arg_job]) ? TRUE : FALSE;
+}
+
+/*
+* Gets the statistics of a running job
+*
+* @param job        Job id
+* @param timeUsed   Total time used by the job in microseconds
+* @param frames     Amount of frames the job was called in
+* @param calls      Amount of calls of the job
+*
+* @return           true if the job is running, false otherwise
+*
+* native bool:GetJobStats(const job, &timeUsed, &frames = 0, &calls = 0);
+*/
+cell AMX_NATIVE_CALL amx_GetJobStats(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_job, arg_timeused, arg_frames, arg_calls };
+
+	uint64 timeUsed;
+	int frames, calls;
+
+	if (!g_jobScheduler.GetStats(params[arg_job], timeUsed, frames, calls))
+		return FALSE;
+
+	*getAmxAddr(amx, params[arg_timeused]) = (cell)min(timeUsed, (uint64)INT_MAX);
+	*getAmxAddr(amx, params[arg_frames]) = frames;
+	*getAmxAddr(amx, params[arg_calls]) = calls;
+	return TRUE;
+}
+
+/*
+* Creates a key to store data on entities, the same name gives the same key within a plugin,
+* other plugins using this name get their own key.
+*
+* @param name       Name of the key
+*
+* @return           Key id
+*
+* native CreateEntityDataKey(const name[]);
+*/
+cell AMX_NATIVE_CALL amx_CreateEntityDataKey(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_name };
+
+	char namebuf[256];
+	return g_entityData.CreateKey(amx, getAmxString(amx, params[arg_name], namebuf));
+}
+
+/*
+* Sets the value of a key on an entity, it's reset to 0 when the entity is freed
+*
+* @param index      Entity index
+* @param key        Key id returned by CreateEntityDataKey
+* @param value      Value to set
+*
+* @return           1 on success, 0 otherwise
+* @error            If the index is not within the range of 0 to maxEntities or
+*                   the entity is not valid, an error will be thrown.
+*
+* native SetEntityData(const index, const key, any:value);
+*/
+cell AMX_NATIVE_CALL amx_SetEntityData(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_index, arg_key, arg_value };
+
+	CHECK_ISENTITY(arg_index);
+
+	if (unlikely(getPrivate<CBaseEntity>(params[arg_index]) == nullptr)) {
+		AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: invalid or uninitialized entity", __FUNCTION__);
+		return FALSE;
+	}
+
+	if (unlikely(!g_entityData.IsValidKey(params[arg_key]))) {
+		AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: invalid key %i", __FUNCTION__, params[arg_key]);
+		return FALSE;
+	}
+
+	g_entityData.SetValue(params[arg_index], params[arg_key], params[arg_value]);
+	return TRUE;
+}
+
+/*
+* Gets the value of a key on an entity
+*
+* @param index      Entity index
+* @param key        Key id returned by CreateEntityDataKey
+*
+* @return           Value of the key, 0 if it was never set
+* @error            If the index is not within the range of 0 to maxEntities, an error will be thrown.
+*
+* native any:GetEntityData(const index, const key);
+*/
+cell AMX_NATIVE_CALL amx_GetEntityData(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_index, arg_key };
+
+	CHECK_ISENTITY(arg_index);
+
+	if (unlikely(!g_entityData.IsValidKey(params[arg_key]))) {
+		AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: invalid key %i", __FUNCTION__, params[arg_key]);
+		return FALSE;
+	}
+
+	return g_entityData.GetValue(params[arg_index], params[arg_key]);
+}
+
+/*
+* Creates a tag, tags are shared between the plugins, the same name gives the same tag
+*
+* @param name       Name of the tag, case insensitive
+*
+* @return           Tag id, -1 if all 64 tags are in use
+*
+* native CreateEntityTag(const name[]);
+*/
+cell AMX_NATIVE_CALL amx_CreateEntityTag(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_name };
+
+	char namebuf[256];
+	return g_entityData.CreateTag(getAmxString(amx, params[arg_name], namebuf));
+}
+
+/*
+* Adds or removes a tag on an entity, tags are removed when the entity is freed
+*
+* @param index      Entity index
+* @param tag        Tag id returned by CreateEntityTag
+* @param set        true to add the tag, false to remove it
+*
+* @return           1 on success, 0 otherwise
+* @error            If the index is not within the range of 0 to maxEntities or
+*                   the entity is not valid, an error will be thrown.
+*
+* native SetEntityTag(const index, const tag, const bool:set = true);
+*/
+cell AMX_NATIVE_CALL amx_SetEntityTag(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_index, arg_tag, arg_set };
+
+	CHECK_ISENTITY(arg_index);
+
+	if (unlikely(getPrivate<CBaseEntity>(params[arg_index]) == nullptr)) {
+		AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: invalid or uninitialized entity", __FUNCTION__);
+		return FALSE;
+	}
+
+	if (unlikely(!g_entityData.IsValidTag(params[arg_tag]))) {
+		AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: invalid tag %i", __FUNCTION__, params[arg_tag]);
+		return FALSE;
+	}
+
+	g_entityData.SetTag(params[arg_index], params[arg_tag], params[arg_set] != FALSE);
+	return TRUE;
+}
+
+/*
+* Checks if an entity has a tag
+*
+* @param index      Entity index
+* @param tag        Tag id returned by CreateEntityTag
+*
+* @return           true if the entity has the tag, false otherwise
+* @error            If the index is not within the range of 0 to maxEntities, an error will be thrown.
+*
+* native bool:HasEntityTag(const index, const tag);
+*/
+cell AMX_NATIVE_CALL amx_HasEntityTag(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_index, arg_tag };
+
+	CHECK_ISENTITY(arg_index);
+
+	if (unlikely(!g_entityData.IsValidTag(params[arg_tag]))) {
+		AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: invalid tag %i", __FUNCTION__, params[arg_tag]);
+		return FALSE;
+	}
+
+	return g_entityData.HasTag(params[arg_index], params[arg_tag]) ? TRUE : FALSE;
+}
+
+/*
+* Gets the entities with a tag
+*
+* @param tag            Tag id returned by CreateEntityTag
+* @param entities       Array to store the entity indexes in
+* @param maxEntities    Size of the array
+*
+* @return               Amount of entities stored
+*
+* native GetEntitiesByTag(const tag, entities[], const maxEntities);
+*/
+cell AMX_NATIVE_CALL amx_GetEntitiesByTag(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_tag, arg_entities, arg_max_entities };
+
+	if (unlikely(!g_entityData.IsValidTag(params[arg_tag]))) {
+		AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: invalid tag %i", __FUNCTION__, params[arg_tag]);
+		return FALSE;
+	}
+
+	const std::vector<int> &tagged = g_entityData.GetTagged(params[arg_tag]);
+	const size_t count = min(tagged.size(), (size_t)max(params[arg_max_entities], 0));
+
+	cell *pEntities = getAmxAddr(amx, params[arg_entities]);
+	for (size_t i = 0; i < count; i++)
+		pEntities[i] = tagged[i];
+
+	return count;
+}
+
+/*
+* Gets the generation of an entity index, it's incremented every time an entity at this index is freed.
+* Store it along with the index to check later that the index still refers to the same entity.
+*
+* @param index      Entity index
+*
+* @return           Generation of the index
+* @error            If the index is not within the range of 0 to maxEntities, an error will be thrown.
+*
+* native GetEntityGeneration(const index);
+*/
+cell AMX_NATIVE_CALL amx_GetEntityGeneration(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_index };
+
+	CHECK_ISENTITY(arg_index);
+
+	return g_entityData.GetGeneration(params[arg_index]);
+}
+
+/*
+* Acquires an entity from the pool of the classname, a parked entity is reused if there is one,
+* otherwise a new entity is created.
+* A reused entity has its entvars and base members reset to the state of a newly created entity,
+* members of derived classes keep the values they had when it was released.
+*
+* @param classname  Entity classname
+*
+* @return           Index of the entity or 0 otherwise
+*
+* native AcquirePooledEntity(const classname[]);
+*/
+cell AMX_NATIVE_CALL amx_AcquirePooledEntity(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_classname };
+
+	char classname[256];
+	return g_entityPool.Acquire(getAmxString(amx, params[arg_classname], classname));
+}
+
+/*
+* Releases an entity acquired with AcquirePooledEntity, the entity is hidden and parked until it's acquired again.
+* Its callbacks, timers, entity data and tags are removed as if it was freed.
+* If the pool is full the entity is removed instead.
+* @note Parked entities keep their classname, so they are still found by classname searches and QueryEntities.
+*       Check the EF_NODRAW effect or keep track of the acquired entities to tell them apart.
+*
+* @param index      Entity index
+*
+* @return           true on success, false if the entity wasn't acquired from a pool or was already released
+* @error            If the index is not within the range of 1 to maxEntities or
+*                   the entity is not valid, an error will be thrown.
+*
+* native bool:ReleasePooledEntity(const index);
+*/
+cell AMX_NATIVE_CALL amx_ReleasePooledEntity(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_index };
+
+	CHECK_ISENTITY(arg_index);
+
+	if (unlikely(getPrivate<CBaseEntity>(params[arg_index]) == nullptr)) {
+		AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: invalid or uninitialized entity", __FUNCTION__);
+		return FALSE;
+	}
+
+	return g_entityPool.Release(params[arg_index]) ? TRUE : FALSE;
+}
+
+/*
+* Sets the max amount of parked entities of a classname, 64 by default.
+* Parked entities exceeding the size are removed.
+*
+* @param classname  Entity classname
+* @param size       Max amount of parked entities
+*
+* @noreturn
+*
+* native SetEntityPoolSize(const classname[], const size);
+*/
+cell AMX_NATIVE_CALL amx_SetEntityPoolSize(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_classname, arg_size };
+
+	char classname[256];
+	g_entityPool.SetSize(getAmxString(amx, params[arg_classname], classname), params[arg_size]);
+	return TRUE;
+}
+
+/*
+* Gets the statistics of the pool of a classname
+*
+* @param classname  Entity classname
+* @param parked     Amount of entities waiting in the pool
+* @param active     Amount of entities acquired and not released yet
+* @param created    Amount of acquires that created a new entity
+* @param reused     Amount of acquires that reused a parked entity
+* @param discarded  Amount of released entities removed because the pool was full
+*
+* @return           true if the pool exists, false otherwise
+*
+* native bool:GetEntityPoolStats(const classname[], &parked, &active = 0, &created = 0, &reused = 0, &discarded = 0);
+*/
+cell AMX_NATIVE_CALL amx_GetEntityPoolStats(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_classname, arg_parked, arg_active, arg_created, arg_reused, arg_discarded };
+
+	char classname[256];
+	CEntityPool::stats_t stats;
+	if (!g_entityPool.GetStats(getAmxString(amx, params[arg_classname], classname), stats))
+		return FALSE;
+
+	*getAmxAddr(amx, params[arg_parked]) = stats.parked;
+	*getAmxAddr(amx, params[arg_active]) = stats.active;
+	*getAmxAddr(amx, params[arg_created]) = stats.created;
+	*getAmxAddr(amx, params[arg_reused]) = stats.reused;
+	*getAmxAddr(amx, params[arg_discarded]) = stats.discarded;
+	return TRUE;
+}
+
+/*
+* Queues an entity to be removed at the start of the next server frame.
+* All the queued entities are removed in one pass, with their callbacks and
+* side table data released in bulk. Safe to use from Think/Touch callbacks and hookchains.
+*
+* @param index      Entity index
+*
+* @return           true if the entity was queued, false if it's already queued
+* @error            If the index is not within the range of maxClients+1 to maxEntities or
+*                   the entity is not valid, an error will be thrown.
+*
+* native bool:QueueEntityRemoval(const index);
+*/
+cell AMX_NATIVE_CALL amx_QueueEntityRemoval(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_index };
+
+	CHECK_ISENTITY(arg_index);
+
+	if (unlikely(params[arg_index] <= gpGlobals->maxClients)) {
+		AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: worldspawn and players can't be removed", __FUNCTION__);
+		return FALSE;
+	}
+
+	if (unlikely(getPrivate<CBaseEntity>(params[arg_index]) == nullptr)) {
+		AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: invalid or uninitialized entity", __FUNCTION__);
+		return FALSE;
+	}
+
+	return g_entityRemoval.Queue(params[arg_index]) ? TRUE : FALSE;
+}
+
+/*
+* Checks if an entity is queued for removal
+*
+* @param index      Entity index
+*
+* @return           true if the entity is queued, false otherwise
+*
+* native bool:IsEntityRemovalQueued(const index);
+*/
+cell AMX_NATIVE_CALL amx_IsEntityRemovalQueued(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_index };
+
+	return g_entityRemoval.IsQueued(params[arg_index]) ? TRUE : FALSE;
+}
+
 AMX_NATIVE_INFO Natives_Common[] =
 {
 	{ "FClassnameIs",         amx_FClassnameIs         },
@@ -698,14 +1632,43 @@ AMX_NATIVE_INFO Natives_Common[] =
 	{ "set_key_value_buffer", amx_set_key_value_buffer },
 	{ "GetBonePosition",      amx_GetBonePosition      },
 	{ "GetAttachment",        amx_GetAttachment        },
+	{ "GetAllBonePositions",  amx_GetAllBonePositions  },
+	{ "GetBonePositions",     amx_GetBonePositions     },
+	{ "GetAllAttachments",    amx_GetAllAttachments    },
+	{ "TraceHitboxes",        amx_TraceHitboxes        },
 	{ "GetBodygroup",         amx_GetBodygroup         },
 	{ "SetBodygroup",         amx_SetBodygroup         },
 	{ "GetSequenceInfo",      amx_GetSequenceInfo      },
+	{ "LookupSequence",       amx_LookupSequence       },
+	{ "LookupBone",           amx_LookupBone           },
+	{ "LookupAttachment",     amx_LookupAttachment     },
+	{ "LookupBodygroup",      amx_LookupBodygroup      },
 	{ "SetThink",             amx_SetThink             },
 	{ "SetTouch",             amx_SetTouch             },
 	{ "SetUse",               amx_SetUse               },
 	{ "SetBlocked",           amx_SetBlocked           },
 	{ "SetMoveDone",          amx_SetMoveDone          },
+	{ "CreateTimer",          amx_CreateTimer          },
+	{ "KillTimer",            amx_KillTimer            },
+	{ "TimerExists",          amx_TimerExists          },
+	{ "GetTimerTimeLeft",     amx_GetTimerTimeLeft     },
+	{ "StartJob",             amx_StartJob             },
+	{ "StopJob",              amx_StopJob              },
+	{ "GetJobStats",          amx_GetJobStats          },
+	{ "CreateEntityDataKey",  amx_CreateEntityDataKey  },
+	{ "SetEntityData",        amx_SetEntityData        },
+	{ "GetEntityData",        amx_GetEntityData        },
+	{ "CreateEntityTag",      amx_CreateEntityTag      },
+	{ "SetEntityTag",         amx_SetEntityTag         },
+	{ "HasEntityTag",         amx_HasEntityTag         },
+	{ "GetEntitiesByTag",     amx_GetEntitiesByTag     },
+	{ "GetEntityGeneration",  amx_GetEntityGeneration  },
+	{ "AcquirePooledEntity",  amx_AcquirePooledEntity  },
+	{ "ReleasePooledEntity",  amx_ReleasePooledEntity  },
+	{ "SetEntityPoolSize",    amx_SetEntityPoolSize    },
+	{ "GetEntityPoolStats",   amx_GetEntityPoolStats   },
+	{ "QueueEntityRemoval",   amx_QueueEntityRemoval   },
+	{ "IsEntityRemovalQueued", amx_IsEntityRemovalQueued },
 
 	{ "CheckVisibilityInOrigin", amx_CheckVisibilityInOrigin },
 
@@ -7,17 +7,19 @@
 * @param function   The function to hook
 * @param callback   The forward to call
 * @param post       Whether or not to forward this in post
+* @param flags      Registration flags, look at the enum HookChainFlags
 *
 * @return           Returns a hook handle. Use EnableHookChain/DisableHookChain to toggle the forward on or off
 *
-* native HookChain:RegisterHookChain(any:function_id, const callback[], post = 0);
+* native HookChain:RegisterHookChain(any:function_id, const callback[], post = 0, HookChainFlags:flags = HCF_NONE);
 */
 cell AMX_NATIVE_CALL RegisterHookChain(AMX *amx, cell *params)
 {
-	enum args_e { arg_count, arg_func, arg_handler, arg_post };
+	enum args_e { arg_count, arg_func, arg_handler, arg_post, arg_flags };
 
 	int func = params[arg_func];
 	int post = params[arg_post];
+	int flags = (PARAMS_COUNT >= 4) ? params[arg_flags] : HOOKFLAG_NONE;
 	auto hook = g_hookManager.getHook(func);
 
 	if (unlikely(hook == nullptr))
@@ -42,14 +44,36 @@ cell AMX_NATIVE_CALL RegisterHookChain(AMX *amx, cell *params)
 		return INVALID_HOOKCHAIN;
 	}
 
-	int fwid = hook->registerForward(amx, funcname);
+	int fwid;
+	if (flags & HOOKFLAG_DEFERRED)
+	{
+		if (unlikely(!post))
+		{
+			AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: deferred delivery is only available for post hooks.", __FUNCTION__);
+			return INVALID_HOOKCHAIN;
+		}
+
+		if (unlikely(!hook->directExec))
+		{
+			AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: function (%s) can't be deferred, it has string or array arguments.", __FUNCTION__, hook->func_name);
+			return INVALID_HOOKCHAIN;
+		}
+
+		// public handler(const events[], const count, const stride)
+		fwid = g_amxxapi.RegisterSPForwardByName(amx, funcname, FP_ARRAY, FP_CELL, FP_CELL, FP_DONE);
+	}
+	else
+	{
+		fwid = hook->registerForward(amx, funcname);
+	}
+
 	if (unlikely(fwid == -1))
 	{
 		AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: register forward failed.", __FUNCTION__);
 		return INVALID_HOOKCHAIN;
 	}
 
-	return g_hookManager.addHandler(amx, func, funcname, fwid, post != 0);
+	return g_hookManager.addHandler(amx, func, funcname, fwid, post != 0, funcid, flags);
 }
 
 /*
@@ -311,8 +335,14 @@ cell AMX_NATIVE_CALL SetHookChainArg(AMX *amx, cell *params)
 		*(bool *)destAddr = *srcAddr != 0;
 		break;
 	case ATYPE_STRING:
-		*(char **)destAddr = getAmxString(srcAddr, g_hookCtx->get_temp_string(amx), CTempStrings::STRING_LEN);
+	{
+		size_t len = 0;
+		while (srcAddr[len])
+			len++;
+
+		*(char **)destAddr = getAmxString(srcAddr, g_hookCtx->get_temp_string(len + 1), len + 1);
 		break;
+	}
 	case ATYPE_CLASSPTR:
 		*(CBaseEntity **)destAddr = getPrivate<CBaseEntity>(*srcAddr);
 		break;
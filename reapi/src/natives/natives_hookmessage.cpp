@@ -566,6 +566,113 @@ cell AMX_NATIVE_CALL ResetModifiedMessageData(AMX *amx, cell *params)
 	return g_activeMessageContext->resetModifiedData(type, number) ? TRUE : FALSE;
 }
 
+/**
+* Sets the priority class of the specified message ID.
+* Low priority messages sent to a single client (MSG_ONE, MSG_ONE_UNRELIABLE) are deferred while the client is choking
+* and sent when its channel has room again. Only the last deferred message of every ID is kept.
+*
+* @param msgid      The ID of the message to set the priority for.
+* @param priority   The priority class, look at the enum MessagePriority
+*
+* @note             The deferred messages are sent again through the message hooks, which see them twice.
+*
+* @return           Returns true if the priority is successfully set, otherwise false.
+*
+* native bool:SetMessagePriority(const msgid, const MessagePriority:priority);
+*/
+cell AMX_NATIVE_CALL SetMessagePriority(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_id, arg_priority };
+
+	CHECK_REQUIREMENTS(ReHLDS);
+
+	int msg_id = params[arg_id];
+
+	// svc_bad (0) is not allowed for hook
+	if (msg_id <= 0 || msg_id >= MAX_USERMESSAGES)
+		return FALSE;
+
+	MessagePriority priority = static_cast<MessagePriority>(params[arg_priority]);
+	if (priority != MSG_PRIORITY_CRITICAL && priority != MSG_PRIORITY_LOW)
+		return FALSE;
+
+	g_messageDeferral.SetPriority(msg_id, priority);
+	return TRUE;
+}
+
+/**
+* Retrieves the priority class of the specified message ID.
+*
+* @param msgid      The ID of the message to retrieve the priority for.
+*
+* @return           Returns the priority class of the message, look at the enum MessagePriority
+*
+* native MessagePriority:GetMessagePriority(const msgid);
+*/
+cell AMX_NATIVE_CALL GetMessagePriority(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_id };
+
+	int msg_id = params[arg_id];
+
+	if (msg_id <= 0 || msg_id >= MAX_USERMESSAGES)
+		return MSG_PRIORITY_CRITICAL;
+
+	return g_messageDeferral.GetPriority(msg_id);
+}
+
+/**
+* Sets when a client is considered choking and how long the low priority messages wait for it.
+*
+* @param reliableFill   Fraction of the reliable buffer of the client from which it's considered choking
+* @param maxDelay       Deferred messages waiting longer than this (in seconds) are dropped
+*
+* @note             A client is also considered choking while the engine holds back its updates (choke on the net graph).
+*
+* @noreturn
+*
+* native SetMessageDeferral(const Float:reliableFill = 0.75, const Float:maxDelay = 2.0);
+*/
+cell AMX_NATIVE_CALL SetMessageDeferral(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_fill, arg_delay };
+
+	CAmxArgs args(amx, params);
+	g_messageDeferral.SetLimits(args[arg_fill], args[arg_delay]);
+	return TRUE;
+}
+
+/**
+* Retrieves the counters of the deferred messages.
+*
+* @param index      Client index, 0 for the totals of all clients
+* @param deferred   Amount of messages deferred
+* @param coalesced  Amount of messages replaced by a newer one with the same ID
+* @param flushed    Amount of deferred messages sent
+* @param dropped    Amount of deferred messages dropped after the max delay or from a full queue
+*
+* @return           Returns the amount of messages currently queued.
+*
+* native GetMessageDeferralStats(const index, &deferred, &coalesced = 0, &flushed = 0, &dropped = 0);
+*/
+cell AMX_NATIVE_CALL GetMessageDeferralStats(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_index, arg_deferred, arg_coalesced, arg_flushed, arg_dropped };
+
+	if (params[arg_index] != 0) {
+		CHECK_ISPLAYER(arg_index);
+	}
+
+	uint32 deferred, coalesced, flushed, dropped;
+	int queued = g_messageDeferral.GetStats(params[arg_index], deferred, coalesced, flushed, dropped);
+
+	*getAmxAddr(amx, params[arg_deferred]) = deferred;
+	*getAmxAddr(amx, params[arg_coalesced]) = coalesced;
+	*getAmxAddr(amx, params[arg_flushed]) = flushed;
+	*getAmxAddr(amx, params[arg_dropped]) = dropped;
+	return queued;
+}
+
 AMX_NATIVE_INFO HookMessage_Natives[] =
 {
 	{ "RegisterMessage",          RegisterMessage          },
@@ -588,6 +695,11 @@ AMX_NATIVE_INFO HookMessage_Natives[] =
 	{ "IsMessageDataModified",    IsMessageDataModified    },
 	{ "ResetModifiedMessageData", ResetModifiedMessageData },
 
+	{ "SetMessagePriority",       SetMessagePriority       },
+	{ "GetMessagePriority",       GetMessagePriority       },
+	{ "SetMessageDeferral",       SetMessageDeferral       },
+	{ "GetMessageDeferralStats",  GetMessageDeferralStats  },
+
 	{ nullptr, nullptr }
 };
 
@@ -405,6 +405,530 @@ cell AMX_NATIVE_CALL get_entvar(AMX *amx, cell *params)
 	return get_member(amx, &pEdict->v, member, dest, element, length);
 }
 
+// cells taken by one value of the member in a columnar array, 0 if it can't be batched
+static size_t getColumnWidth(const member_t *member)
+{
+	switch (member->type)
+	{
+	case MEMBER_VECTOR:
+		return 3;
+	case MEMBER_FLOAT:
+	case MEMBER_DOUBLE:
+	case MEMBER_INTEGER:
+	case MEMBER_SHORT:
+	case MEMBER_BYTE:
+	case MEMBER_BOOL:
+	case MEMBER_CLASSPTR:
+	case MEMBER_EHANDLE:
+	case MEMBER_EDICT:
+	case MEMBER_EVARS:
+		return 1;
+	default:
+		return 0;
+	}
+}
+
+static bool isEntityMember(const member_t *member)
+{
+	return member->type == MEMBER_CLASSPTR || member->type == MEMBER_EHANDLE || member->type == MEMBER_EDICT || member->type == MEMBER_EVARS;
+}
+
+// validates the entity indexes and the var ids once for the whole batch
+static size_t prepareEntvarsBatch(AMX *amx, cell *params, std::vector<entvars_t *> &entities, std::vector<const member_t *> &columns, bool needPrivateData, const char *funcname)
+{
+	enum args_e { arg_count, arg_entities, arg_num_entities, arg_vars, arg_num_vars, arg_data, arg_maxcells };
+
+	const cell *pEntities = getAmxAddr(amx, params[arg_entities]);
+	const cell *pVars = getAmxAddr(amx, params[arg_vars]);
+	const int numEntities = params[arg_num_entities];
+	const int numVars = params[arg_num_vars];
+
+	if (unlikely(numEntities < 0 || numVars < 0)) {
+		AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: invalid amount of entities (%d) or vars (%d)", funcname, numEntities, numVars);
+		return 0;
+	}
+
+	entities.clear();
+	columns.clear();
+
+	size_t width = 0;
+	for (int i = 0; i < numVars; i++)
+	{
+		const member_t *member = memberlist[pVars[i]];
+		if (unlikely(member == nullptr || (pVars[i] / MAX_REGION_RANGE) != memberlist_t::mt_entvars)) {
+			AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: unknown entvar id %i", funcname, pVars[i]);
+			return 0;
+		}
+
+		size_t cells = getColumnWidth(member);
+		if (unlikely(cells == 0)) {
+			AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: member type %s (%s) is not supported", funcname, member_t::getTypeString(member->type), member->name);
+			return 0;
+		}
+
+		width += cells;
+		columns.push_back(member);
+	}
+
+	const size_t total = width * numEntities;
+	if (unlikely(total > (size_t)params[arg_maxcells])) {
+		AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: array is too small, %u cells required", funcname, total);
+		return 0;
+	}
+
+	for (int i = 0; i < numEntities; i++)
+	{
+		const int index = pEntities[i];
+		entvars_t *pev = nullptr;
+
+		if (index >= 0 && index < gpGlobals->maxEntities)
+		{
+			edict_t *pEdict = edictByIndex(index);
+			if (!pEdict->free && (!needPrivateData || pEdict->pvPrivateData))
+				pev = &pEdict->v;
+		}
+
+		entities.push_back(pev);
+	}
+
+	return total;
+}
+
+/*
+* Gathers entvars of several entities into a columnar array.
+* The array holds one column per var, in the order of the vars array, each column holds the value for every entity in the order of the entities array.
+* Vector vars take 3 cells per entity, string vars are not supported.
+* Values of invalid or free entities are set to 0 (NULLENT for entity vars).
+*
+* @param entities       Array of entity indexes
+* @param numEntities    Amount of entities
+* @param vars           Array of var_* ids, look at the enum EntVars
+* @param numVars        Amount of vars
+* @param output         Array to fill
+* @param maxcells       Size of the output array
+*
+* @return               Amount of cells written, 0 on error
+*
+* native get_entvars_batch(const entities[], const numEntities, const EntVars:vars[], const numVars, any:output[], const maxcells);
+*/
+cell AMX_NATIVE_CALL get_entvars_batch(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_entities, arg_num_entities, arg_vars, arg_num_vars, arg_output, arg_maxcells };
+
+	static std::vector<entvars_t *> entities;
+	static std::vector<const member_t *> columns;
+
+	size_t total = prepareEntvarsBatch(amx, params, entities, columns, false, __FUNCTION__);
+	if (!total)
+		return FALSE;
+
+	cell *dest = getAmxAddr(amx, params[arg_output]);
+	for (auto member : columns)
+	{
+		const size_t width = getColumnWidth(member);
+		const cell invalid = isEntityMember(member) ? AMX_NULLENT : 0;
+
+		for (auto pev : entities)
+		{
+			if (pev == nullptr) {
+				for (size_t i = 0; i < width; i++)
+					dest[i] = invalid;
+			}
+			else if (member->type == MEMBER_VECTOR) {
+				get_member(amx, pev, member, dest, 0, 0);
+			}
+			else {
+				*dest = get_member(amx, pev, member, nullptr, 0, 0);
+			}
+
+			dest += width;
+		}
+	}
+
+	return total;
+}
+
+/*
+* Scatters a columnar array into entvars of several entities, the layout is the same as in get_entvars_batch.
+* Invalid or free entities are skipped.
+*
+* @param entities       Array of entity indexes
+* @param numEntities    Amount of entities
+* @param vars           Array of var_* ids, look at the enum EntVars
+* @param numVars        Amount of vars
+* @param input          Array with the values
+* @param maxcells       Size of the input array
+*
+* @return               Amount of cells read, 0 on error
+*
+* native set_entvars_batch(const entities[], const numEntities, const EntVars:vars[], const numVars, const any:input[], const maxcells);
+*/
+cell AMX_NATIVE_CALL set_entvars_batch(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_entities, arg_num_entities, arg_vars, arg_num_vars, arg_input, arg_maxcells };
+
+	static std::vector<entvars_t *> entities;
+	static std::vector<const member_t *> columns;
+
+	size_t total = prepareEntvarsBatch(amx, params, entities, columns, true, __FUNCTION__);
+	if (!total)
+		return FALSE;
+
+	cell *value = getAmxAddr(amx, params[arg_input]);
+	for (auto member : columns)
+	{
+		const size_t width = getColumnWidth(member);
+		for (auto pev : entities)
+		{
+			if (pev) {
+				set_member(amx, pev, member, value, 0);
+			}
+
+			value += width;
+		}
+	}
+
+	return total;
+}
+
+// clauses and comparisons of QueryEntities
+enum EntityQuery
+{
+	QUERY_OWNER = 0,
+	QUERY_FLAGS_ALL,
+	QUERY_FLAGS_ANY,
+	QUERY_FLAGS_NONE,
+	QUERY_MOVETYPE,
+	QUERY_SOLID,
+	QUERY_RADIUS,
+	QUERY_MEMBER,
+};
+
+enum EntityQueryCmp
+{
+	QUERY_CMP_EQUAL = 0,
+	QUERY_CMP_NOT_EQUAL,
+	QUERY_CMP_LESS,
+	QUERY_CMP_LESS_EQUAL,
+	QUERY_CMP_GREATER,
+	QUERY_CMP_GREATER_EQUAL,
+	QUERY_CMP_BITS_ALL,
+	QUERY_CMP_BITS_ANY,
+	QUERY_CMP_BITS_NONE,
+};
+
+struct queryclause_t
+{
+	EntityQuery op;
+	cell value;
+
+	// QUERY_RADIUS
+	Vector origin;
+	float radiusSqr;
+
+	// QUERY_MEMBER
+	cell memberId;
+	const member_t *member;
+	EntityQueryCmp cmp;
+};
+
+// cells taken by the operands of each clause
+static int getQueryOperands(cell op)
+{
+	switch (op)
+	{
+	case QUERY_OWNER:
+	case QUERY_FLAGS_ALL:
+	case QUERY_FLAGS_ANY:
+	case QUERY_FLAGS_NONE:
+	case QUERY_MOVETYPE:
+	case QUERY_SOLID:
+		return 1;
+	case QUERY_RADIUS:
+		return 4;
+	case QUERY_MEMBER:
+		return 3;
+	default:
+		return -1;
+	}
+}
+
+// validates the query and resolves the member ids once for the whole scan
+static bool compileEntityQuery(AMX *amx, const cell *pQuery, int querySize, std::vector<queryclause_t> &clauses, const char *funcname)
+{
+	clauses.clear();
+
+	for (int i = 0; i < querySize; )
+	{
+		const int operands = getQueryOperands(pQuery[i]);
+		if (unlikely(operands < 0)) {
+			AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: unknown query clause %i at cell %i", funcname, pQuery[i], i);
+			return false;
+		}
+
+		if (unlikely(i + operands >= querySize)) {
+			AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: query clause at cell %i is truncated", funcname, i);
+			return false;
+		}
+
+		const cell *operand = &pQuery[i + 1];
+
+		queryclause_t clause = {};
+		clause.op = (EntityQuery)pQuery[i];
+		clause.value = operand[0];
+
+		if (clause.op == QUERY_RADIUS)
+		{
+			const float radius = *(float *)&operand[3];
+			clause.origin = Vector(*(float *)&operand[0], *(float *)&operand[1], *(float *)&operand[2]);
+			clause.radiusSqr = radius * radius;
+		}
+		else if (clause.op == QUERY_MEMBER)
+		{
+			const member_t *member = memberlist[operand[0]];
+			if (unlikely(member == nullptr)) {
+				AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: unknown member id %i", funcname, operand[0]);
+				return false;
+			}
+
+			const auto table = memberlist_t::members_tables_e(operand[0] / MAX_REGION_RANGE);
+			if (table != memberlist_t::mt_entvars)
+			{
+				if (unlikely(member->pfnIsRefsToClass == nullptr || table == memberlist_t::mt_gamerules)) {
+					AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: member %s is not a member of an entity", funcname, member->name);
+					return false;
+				}
+
+				if (unlikely(!api_cfg.hasReGameDLL())) {
+					AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: member %s requires ReGameDll", funcname, member->name);
+					return false;
+				}
+			}
+
+			switch (member->type)
+			{
+			case MEMBER_FLOAT:
+			case MEMBER_DOUBLE:
+			case MEMBER_INTEGER:
+			case MEMBER_SHORT:
+			case MEMBER_BYTE:
+			case MEMBER_BOOL:
+			case MEMBER_CLASSPTR:
+			case MEMBER_EHANDLE:
+			case MEMBER_EDICT:
+			case MEMBER_EVARS:
+				break;
+			default:
+				AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: member type %s (%s) is not supported", funcname, member_t::getTypeString(member->type), member->name);
+				return false;
+			}
+
+			if (unlikely(operand[1] < QUERY_CMP_EQUAL || operand[1] > QUERY_CMP_BITS_NONE)) {
+				AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: unknown comparison %i", funcname, operand[1]);
+				return false;
+			}
+
+			clause.memberId = operand[0];
+			clause.member = member;
+			clause.cmp = (EntityQueryCmp)operand[1];
+			clause.value = operand[2];
+		}
+
+		clauses.push_back(clause);
+		i += operands + 1;
+	}
+
+	return true;
+}
+
+template <typename T>
+static bool compareQueryValue(EntityQueryCmp cmp, T a, T b)
+{
+	switch (cmp)
+	{
+	case QUERY_CMP_EQUAL:         return a == b;
+	case QUERY_CMP_NOT_EQUAL:     return a != b;
+	case QUERY_CMP_LESS:          return a < b;
+	case QUERY_CMP_LESS_EQUAL:    return a <= b;
+	case QUERY_CMP_GREATER:       return a > b;
+	case QUERY_CMP_GREATER_EQUAL: return a >= b;
+	default:                      return false;
+	}
+}
+
+static bool matchEntityQuery(AMX *amx, CBaseEntity *pEntity, const std::vector<queryclause_t> &clauses)
+{
+	entvars_t *pev = pEntity->pev;
+
+	for (auto &clause : clauses)
+	{
+		switch (clause.op)
+		{
+		case QUERY_OWNER:
+		{
+			const cell owner = pev->owner ? (cell)indexOfEdict(pev->owner) : AMX_NULLENT;
+			if (owner != clause.value)
+				return false;
+			break;
+		}
+		case QUERY_FLAGS_ALL:
+			if ((pev->flags & clause.value) != clause.value)
+				return false;
+			break;
+		case QUERY_FLAGS_ANY:
+			if (!(pev->flags & clause.value))
+				return false;
+			break;
+		case QUERY_FLAGS_NONE:
+			if (pev->flags & clause.value)
+				return false;
+			break;
+		case QUERY_MOVETYPE:
+			if (pev->movetype < 0 || pev->movetype >= 32 || !(clause.value & BIT(pev->movetype)))
+				return false;
+			break;
+		case QUERY_SOLID:
+			if (pev->solid < 0 || pev->solid >= 32 || !(clause.value & BIT(pev->solid)))
+				return false;
+			break;
+		case QUERY_RADIUS:
+		{
+			// same as the engine's FindEntityInSphere, measured to the center of the absolute box
+			Vector vecDelta = clause.origin - (pev->absmin + pev->absmax) * 0.5f;
+			if (DotProduct(vecDelta, vecDelta) > clause.radiusSqr)
+				return false;
+			break;
+		}
+		case QUERY_MEMBER:
+		{
+			void *pdata;
+			if (clause.member->pfnIsRefsToClass)
+			{
+				pdata = get_pdata_custom(pEntity, clause.memberId);
+				if (!pdata || !clause.member->pfnIsRefsToClass(pdata))
+					return false;
+			}
+			else
+			{
+				pdata = pev;
+			}
+
+			cell value = get_member(amx, pdata, clause.member, nullptr, 0);
+
+			switch (clause.cmp)
+			{
+			case QUERY_CMP_BITS_ALL:
+				if ((value & clause.value) != clause.value)
+					return false;
+				break;
+			case QUERY_CMP_BITS_ANY:
+				if (!(value & clause.value))
+					return false;
+				break;
+			case QUERY_CMP_BITS_NONE:
+				if (value & clause.value)
+					return false;
+				break;
+			default:
+				if (clause.member->type == MEMBER_FLOAT || clause.member->type == MEMBER_DOUBLE) {
+					if (!compareQueryValue(clause.cmp, *(float *)&value, *(float *)&clause.value))
+						return false;
+				}
+				else if (!compareQueryValue(clause.cmp, value, clause.value)) {
+					return false;
+				}
+				break;
+			}
+			break;
+		}
+		}
+	}
+
+	return true;
+}
+
+/*
+* Finds the entities matching a query in a single scan of the entity list.
+*
+* @param classnames     Classnames to match separated by spaces or commas, e.g. "grenade weaponbox", empty string to match any
+* @param query          Array of clauses, each clause is a QUERY_* id followed by its operands, look at the enum EntityQuery
+* @param querySize      Amount of cells in the query
+* @param entities       Array to store the indexes of the found entities
+* @param maxEntities    Size of the entities array
+*
+* @return               Amount of entities stored
+*
+* native QueryEntities(const classnames[], const any:query[], const querySize, entities[], const maxEntities);
+*/
+cell AMX_NATIVE_CALL QueryEntities(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_classnames, arg_query, arg_query_size, arg_entities, arg_max_entities };
+
+	static std::vector<queryclause_t> clauses;
+	static std::vector<std::string> classnames;
+
+	if (unlikely(params[arg_query_size] < 0 || params[arg_max_entities] < 0)) {
+		AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: invalid size of query (%d) or entities (%d)", __FUNCTION__, params[arg_query_size], params[arg_max_entities]);
+		return 0;
+	}
+
+	if (!compileEntityQuery(amx, getAmxAddr(amx, params[arg_query]), params[arg_query_size], clauses, __FUNCTION__))
+		return 0;
+
+	char classnamebuf[1024];
+	const char *pszClassnames = getAmxString(amx, params[arg_classnames], classnamebuf);
+
+	classnames.clear();
+	for (const char *p = pszClassnames; *p; )
+	{
+		size_t len = strcspn(p, " ,");
+		if (len > 0)
+			classnames.emplace_back(p, len);
+
+		p += len;
+		if (*p)
+			p++;
+	}
+
+	cell *pEntities = getAmxAddr(amx, params[arg_entities]);
+	const int maxEntities = params[arg_max_entities];
+
+	int count = 0;
+	for (int i = 1; i < gpGlobals->maxEntities && count < maxEntities; i++)
+	{
+		CBaseEntity *pEntity = getPrivate<CBaseEntity>(i);
+		if (!pEntity)
+			continue;
+
+		if (pEntity->IsPlayer() && pEntity->has_disconnected)
+			continue;
+
+		if (!classnames.empty())
+		{
+			const char *pszClassname = STRING(pEntity->pev->classname);
+
+			bool found = false;
+			for (auto &classname : classnames)
+			{
+				if (classname == pszClassname) {
+					found = true;
+					break;
+				}
+			}
+
+			if (!found)
+				continue;
+		}
+
+		if (!matchEntityQuery(amx, pEntity, clauses))
+			continue;
+
+		pEntities[count++] = i;
+	}
+
+	return count;
+}
+
 /*
 * Sets playermove var.
 *
@@ -882,6 +1406,11 @@ AMX_NATIVE_INFO EngineVars_Natives[] =
 	{ "set_entvar", set_entvar },
 	{ "get_entvar", get_entvar },
 
+	{ "set_entvars_batch", set_entvars_batch },
+	{ "get_entvars_batch", get_entvars_batch },
+
+	{ "QueryEntities", QueryEntities },
+
 	{ "set_ucmd", set_ucmd },
 	{ "get_ucmd", get_ucmd },
 
@@ -2588,6 +2588,125 @@ cell AMX_NATIVE_CALL rg_get_can_hear_player(AMX* amx, cell* params)
 	return CSGameRules()->m_VoiceGameMgr.m_pHelper->GetCanHearPlayer(pListener, pSender);
 }
 
+/*
+* Sets the route of the voice matrix consulted before the CSGameRules_CanPlayerHearPlayer forwards.
+* The decided pairs don't reach the forwards nor the game rules.
+*
+* @param listener              Listener player id or 0 for all players
+* @param sender                Sender player id or 0 for all players
+* @param route                 Route to set, look at the enum VoiceRoute
+*
+* @noreturn
+*
+* native rg_voice_matrix_set(const listener, const sender, const VoiceRoute:route);
+*/
+cell AMX_NATIVE_CALL rg_voice_matrix_set(AMX* amx, cell* params)
+{
+	enum args_e { arg_count, arg_listener, arg_sender, arg_route };
+
+	CHECK_GAMERULES();
+
+	if (params[arg_listener] != 0) {
+		CHECK_ISPLAYER(arg_listener);
+	}
+
+	if (params[arg_sender] != 0) {
+		CHECK_ISPLAYER(arg_sender);
+	}
+
+	VoiceRoute route = static_cast<VoiceRoute>(params[arg_route]);
+	if (route < VOICE_ROUTE_DEFAULT || route > VOICE_ROUTE_HEAR) {
+		AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: invalid route %d", __FUNCTION__, params[arg_route]);
+		return FALSE;
+	}
+
+	g_voiceMatrix.Set(params[arg_listener], params[arg_sender], route);
+	return TRUE;
+}
+
+/*
+* Gets the route of the voice matrix.
+*
+* @param listener              Listener player id
+* @param sender                Sender player id
+*
+* @return                      Route of the pair, look at the enum VoiceRoute
+*
+* native VoiceRoute:rg_voice_matrix_get(const listener, const sender);
+*/
+cell AMX_NATIVE_CALL rg_voice_matrix_get(AMX* amx, cell* params)
+{
+	enum args_e { arg_count, arg_listener, arg_sender };
+
+	CHECK_ISPLAYER(arg_listener);
+	CHECK_ISPLAYER(arg_sender);
+
+	return g_voiceMatrix.Get(params[arg_listener], params[arg_sender]);
+}
+
+/*
+* Sets the voice matrix in bulk, one row of sender bits per listener.
+* Senders are set as (1 << (sender & 31)), the senders outside of the decided bits keep their route.
+*
+* @param hearBits              Senders heard by each listener, indexed by listener id
+* @param decidedBits           Senders decided by the matrix for each listener, indexed by listener id
+* @param size                  Size of the arrays
+*
+* @noreturn
+*
+* native rg_voice_matrix_set_rows(const hearBits[], const decidedBits[], const size = MAX_PLAYERS + 1);
+*/
+cell AMX_NATIVE_CALL rg_voice_matrix_set_rows(AMX* amx, cell* params)
+{
+	enum args_e { arg_count, arg_hear, arg_decided, arg_size };
+
+	CHECK_GAMERULES();
+
+	cell *hearBits = getAmxAddr(amx, params[arg_hear]);
+	cell *decidedBits = getAmxAddr(amx, params[arg_decided]);
+
+	const int size = min<int>(params[arg_size], gpGlobals->maxClients + 1);
+	for (int i = 1; i < size; i++)
+	{
+		g_voiceMatrix.SetRow(i, hearBits[i], decidedBits[i]);
+	}
+
+	return TRUE;
+}
+
+/*
+* Decides the routes of all connected players from their team and alive state.
+* Call it again when the teams or the alive players change.
+*
+* @param rules                 Voice rules, look at the enum VoiceRule
+*
+* @noreturn
+*
+* native rg_voice_matrix_apply_rules(const VoiceRule:rules = VOICE_RULE_ALLTALK);
+*/
+cell AMX_NATIVE_CALL rg_voice_matrix_apply_rules(AMX* amx, cell* params)
+{
+	enum args_e { arg_count, arg_rules };
+
+	CHECK_GAMERULES();
+
+	g_voiceMatrix.ApplyRules(params[arg_rules]);
+	return TRUE;
+}
+
+/*
+* Removes all routes of the voice matrix, the forwards and the game rules decide again.
+*
+* @noreturn
+*
+* native rg_voice_matrix_clear();
+*/
+cell AMX_NATIVE_CALL rg_voice_matrix_clear(AMX* amx, cell* params)
+{
+	g_voiceMatrix.Clear();
+	return TRUE;
+}
+
 /*
 * Spawn a head gib
 *
@@ -3470,6 +3589,80 @@ cell AMX_NATIVE_CALL rg_trace_hull(AMX *amx, cell *params)
 	return TRUE;
 }
 
+/*
+* Copies the selected columns of the per-frame player state snapshot into arrays, all clients at once.
+* The snapshot is taken on the first access in a frame, later changes in the same frame are not reflected.
+* Pass one array per selected column, in the order of the PlayerStateColumn enum.
+* Scalar columns need MAX_PLAYERS + 1 cells and are indexed by player index,
+* vector columns need (MAX_PLAYERS + 1) * 3 cells and are indexed by (player index * 3 + axis).
+*
+* @param columns    Bitsum of the columns to copy, see PlayerStateColumn enum
+*
+* @return           Amount of connected players
+*
+* native rg_get_players_state(const PlayerStateColumn:columns, any:...);
+*/
+cell AMX_NATIVE_CALL rg_get_players_state(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_columns, arg_first_column };
+
+	const int columns = params[arg_columns];
+	const size_t count = gpGlobals->maxClients + 1;
+
+	g_playerSnapshot.Update();
+
+	size_t arg = arg_first_column;
+	for (int column = PSC_ORIGIN; column & PSC_ALL; column <<= 1)
+	{
+		if (!(columns & column))
+			continue;
+
+		if (unlikely(arg > PARAMS_COUNT))
+		{
+			AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: not enough arrays passed for the selected columns.", __FUNCTION__);
+			return FALSE;
+		}
+
+		g_playerSnapshot.CopyColumn((PlayerStateColumn)column, getAmxAddr(amx, params[arg++]), count);
+	}
+
+	return g_playerSnapshot.GetNumConnected();
+}
+
+/*
+* Retrieves bitsums of the connected and alive players and of the team members from the per-frame player state snapshot.
+* Player bits are set as (1 << (index & 31)).
+*
+* @param connected      Connected players
+* @param alive          Alive players
+* @param terrorists     Players in the terrorist team
+* @param cts            Players in the counter-terrorist team
+* @param spectators     Players in the spectator team
+*
+* @return               Amount of connected players
+*
+* native rg_get_players_bits(&connected, &alive = 0, &terrorists = 0, &cts = 0, &spectators = 0);
+*/
+cell AMX_NATIVE_CALL rg_get_players_bits(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_connected, arg_alive, arg_terrorists, arg_cts, arg_spectators };
+
+	g_playerSnapshot.Update();
+
+	const int bits[] = {
+		g_playerSnapshot.GetConnectedBits(),
+		g_playerSnapshot.GetAliveBits(),
+		g_playerSnapshot.GetTeamBits(TERRORIST),
+		g_playerSnapshot.GetTeamBits(CT),
+		g_playerSnapshot.GetTeamBits(SPECTATOR)
+	};
+
+	for (size_t i = arg_connected; i <= min((size_t)arg_spectators, PARAMS_COUNT); i++)
+		*getAmxAddr(amx, params[i]) = bits[i - arg_connected];
+
+	return g_playerSnapshot.GetNumConnected();
+}
+
 AMX_NATIVE_INFO Misc_Natives_RG[] =
 {
 	{ "rg_set_animation",             rg_set_animation             },
@@ -3562,6 +3755,11 @@ AMX_NATIVE_INFO Misc_Natives_RG[] =
 	{ "rg_reset_can_hear_player",     rg_reset_can_hear_player     },
 	{ "rg_set_can_hear_player",       rg_set_can_hear_player       },
 	{ "rg_get_can_hear_player",       rg_get_can_hear_player       },
+	{ "rg_voice_matrix_set",          rg_voice_matrix_set          },
+	{ "rg_voice_matrix_get",          rg_voice_matrix_get          },
+	{ "rg_voice_matrix_set_rows",     rg_voice_matrix_set_rows     },
+	{ "rg_voice_matrix_apply_rules",  rg_voice_matrix_apply_rules  },
+	{ "rg_voice_matrix_clear",        rg_voice_matrix_clear        },
 
 	{ "rg_spawn_head_gib",            rg_spawn_head_gib            },
 	{ "rg_spawn_random_gibs",         rg_spawn_random_gibs         },
@@ -3589,6 +3787,9 @@ AMX_NATIVE_INFO Misc_Natives_RG[] =
 	{ "rg_trace_line",                rg_trace_line                },
 	{ "rg_trace_hull",                rg_trace_hull                },
 
+	{ "rg_get_players_state",         rg_get_players_state         },
+	{ "rg_get_players_bits",          rg_get_players_bits          },
+
 	{ nullptr, nullptr }
 };
 
@@ -3887,6 +4088,717 @@ cell AMX_NATIVE_CALL rh_set_server_pause(AMX *amx, cell *params)
 	return TRUE;
 }
 
+/*
+* Sets how many states per player are kept for lag compensation.
+* The states are recorded every server frame, 0 disables the recording.
+*
+* @param records    Amount of states per player, at most 256
+*
+* @noreturn
+*
+* native rh_lagcomp_set_history(const records);
+*/
+cell AMX_NATIVE_CALL rh_lagcomp_set_history(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_records };
+
+	g_lagCompensation.SetHistory(params[arg_records]);
+	return TRUE;
+}
+
+/*
+* Moves all players except the client back to where the client saw them, calls the callback
+* and moves them back to their current state once it has returned.
+*
+* @param index      Client index
+* @param callback   The forward to call while the players are rewound
+* @param viewTime   Game time to rewind to, a negative value means the client's view time
+* @param params     Optional set of data to pass through to callback
+* @param len        Optional size of data
+*
+* @return           Amount of moved players
+*
+* native rh_lagcomp_rewind(const index, const callback[], const Float:viewTime = -1.0, const params[] = "", const len = 0);
+*/
+cell AMX_NATIVE_CALL rh_lagcomp_rewind(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_index, arg_handler, arg_time, arg_params, arg_len };
+
+	CHECK_ISPLAYER(arg_index);
+
+	client_t *pClient = clientOfIndex(params[arg_index]);
+	CHECK_CLIENT_CONNECTED(pClient, arg_index);
+
+	if (unlikely(g_lagCompensation.IsRewound())) {
+		AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: can't be called while the players are already rewound", __FUNCTION__);
+		return FALSE;
+	}
+
+	char namebuf[256];
+	const char *funcname = getAmxString(amx, params[arg_handler], namebuf);
+
+	cell *pParams = (PARAMS_COUNT >= 4) ? getAmxAddr(amx, params[arg_params]) : nullptr;
+	size_t iParamsLen = (PARAMS_COUNT >= 5) ? params[arg_len] : 0;
+
+	int fwdid;
+	if (iParamsLen > 0)
+		fwdid = g_amxxapi.RegisterSPForwardByName(amx, funcname, FP_CELL, FP_CELL, FP_ARRAY, FP_DONE);
+	else
+		fwdid = g_amxxapi.RegisterSPForwardByName(amx, funcname, FP_CELL, FP_CELL, FP_DONE);
+
+	if (unlikely(fwdid == -1)) {
+		AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: public function \"%s\" not found.", __FUNCTION__, funcname);
+		return FALSE;
+	}
+
+	float flTargetTime = CAmxArg(amx, params[arg_time]);
+	if (flTargetTime < 0.0f)
+		flTargetTime = CLagCompensation::GetViewTime(params[arg_index]);
+
+	int numMoved = g_lagCompensation.Rewind(params[arg_index], flTargetTime);
+
+	if (iParamsLen > 0)
+		g_amxxapi.ExecuteForward(fwdid, params[arg_index], numMoved, g_amxxapi.PrepareCellArrayA(pParams, iParamsLen, false));
+	else
+		g_amxxapi.ExecuteForward(fwdid, params[arg_index], numMoved);
+
+	// the rewind never outlives the callback, even if it has failed
+	g_lagCompensation.Restore();
+	g_amxxapi.UnregisterSPForward(fwdid);
+
+	return numMoved;
+}
+
+/*
+* Gets the game time the client currently sees the world at, based on its latency and interpolation.
+*
+* @param index      Client index
+*
+* @return           View time of the client
+*
+* native Float:rh_lagcomp_get_view_time(const index);
+*/
+cell AMX_NATIVE_CALL rh_lagcomp_get_view_time(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_index };
+
+	CHECK_ISPLAYER(arg_index);
+
+	client_t *pClient = clientOfIndex(params[arg_index]);
+	CHECK_CLIENT_CONNECTED(pClient, arg_index);
+
+	float flViewTime = CLagCompensation::GetViewTime(params[arg_index]);
+	return *(cell *)&flViewTime;
+}
+
+/*
+* Limits the rate of connectionless packets (server queries, getchallenge, connect) per source address.
+* Every address has a bucket of tokens refilled at the rate, a packet takes a token and is dropped if the bucket is empty.
+* Packets are dropped before the engine parses them and without calling any plugin forward.
+* The settings are kept across map changes.
+*
+* @param rate       Packets per second allowed per address, 0.0 disables the limiter
+* @param burst      Size of the bucket, amount of packets an address can send at once
+* @param maxSources Amount of addresses tracked, the least recently seen one is forgotten when there is no room
+*
+* @noreturn
+*
+* native rh_packet_limiter_set(const Float:rate, const Float:burst, const maxSources = 4096);
+*/
+cell AMX_NATIVE_CALL rh_packet_limiter_set(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_rate, arg_burst, arg_max_sources };
+
+	CAmxArgs args(amx, params);
+	g_packetLimiter.SetRate(args[arg_rate], args[arg_burst], (PARAMS_COUNT >= 3) ? params[arg_max_sources] : PACKET_LIMITER_DEFAULT_SOURCES);
+	return TRUE;
+}
+
+/*
+* Gets the counters of the connectionless packet limiter
+*
+* @param accepted   Amount of accepted packets
+* @param dropped    Amount of dropped packets
+* @param evicted    Amount of addresses forgotten to make room for new ones
+* @param sources    Amount of addresses currently tracked
+* @param reset      Reset the counters after reading them
+*
+* @noreturn
+*
+* native rh_packet_limiter_stats(&accepted, &dropped = 0, &evicted = 0, &sources = 0, const bool:reset = false);
+*/
+cell AMX_NATIVE_CALL rh_packet_limiter_stats(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_accepted, arg_dropped, arg_evicted, arg_sources, arg_reset };
+
+	CPacketLimiter::stats_t stats;
+	g_packetLimiter.GetStats(stats);
+
+	*getAmxAddr(amx, params[arg_accepted]) = stats.accepted;
+	*getAmxAddr(amx, params[arg_dropped]) = stats.dropped;
+	*getAmxAddr(amx, params[arg_evicted]) = stats.evicted;
+	*getAmxAddr(amx, params[arg_sources]) = stats.sources;
+
+	if (params[arg_reset])
+		g_packetLimiter.ResetStats();
+
+	return TRUE;
+}
+
+/*
+* Limits the rate of string commands (say, buy, menuselect, fullupdate, ...) per client.
+* Every client has a bucket of tokens refilled at the rate, a command takes its cost in tokens
+* and is dropped if there aren't enough of them.
+* Commands are checked before the engine, the game dll or any plugin forward sees them.
+*
+* @param rate           Tokens per second given to every client, 0.0 disables the limiter
+* @param burst          Size of the bucket, amount of tokens a client can spend at once
+* @param action         What to do with a client over the limit, look at the enum StringCmdAction
+* @param kickMessage    Message shown to kicked clients
+*
+* @noreturn
+*
+* native rh_stringcmd_limiter_set(const Float:rate, const Float:burst, const StringCmdAction:action = STRINGCMD_DROP, const kickMessage[] = "");
+*/
+cell AMX_NATIVE_CALL rh_stringcmd_limiter_set(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_rate, arg_burst, arg_action, arg_message };
+
+	CAmxArgs args(amx, params);
+
+	StringCmdAction action = (PARAMS_COUNT >= 3) ? (StringCmdAction)params[arg_action] : STRINGCMD_DROP;
+	if (unlikely(action != STRINGCMD_DROP && action != STRINGCMD_KICK)) {
+		AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: unknown action %d", __FUNCTION__, action);
+		return FALSE;
+	}
+
+	char messagebuf[128];
+	const char *message = (PARAMS_COUNT >= 4) ? getAmxString(amx, params[arg_message], messagebuf) : "";
+
+	g_stringCmdLimiter.SetRate(args[arg_rate], args[arg_burst], action, message);
+	return TRUE;
+}
+
+/*
+* Sets the amount of tokens a string command takes, every command costs 1.0 by default.
+*
+* @param command    Command name, case insensitive
+* @param cost       Tokens taken by the command, 0.0 makes the command unlimited
+*
+* @noreturn
+*
+* native rh_stringcmd_set_cost(const command[], const Float:cost);
+*/
+cell AMX_NATIVE_CALL rh_stringcmd_set_cost(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_command, arg_cost };
+
+	CAmxArgs args(amx, params);
+
+	char commandbuf[32];
+	g_stringCmdLimiter.SetCost(getAmxString(amx, params[arg_command], commandbuf), args[arg_cost]);
+	return TRUE;
+}
+
+/*
+* Gets the counters of the string command limiter
+*
+* @param index      Client index, 0 for the totals of all clients
+* @param accepted   Amount of accepted commands
+* @param dropped    Amount of dropped commands
+*
+* @noreturn
+*
+* native rh_stringcmd_stats(const index, &accepted, &dropped = 0);
+*/
+cell AMX_NATIVE_CALL rh_stringcmd_stats(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_index, arg_accepted, arg_dropped };
+
+	if (params[arg_index] != 0) {
+		CHECK_ISPLAYER(arg_index);
+	}
+
+	uint32 accepted, dropped;
+	g_stringCmdLimiter.GetStats(params[arg_index], accepted, dropped);
+
+	*getAmxAddr(amx, params[arg_accepted]) = accepted;
+	*getAmxAddr(amx, params[arg_dropped]) = dropped;
+	return TRUE;
+}
+
+/*
+* Adds a rule rewriting the userinfo sent in scoreboard updates (name, model, custom keys, ...).
+* Rules are applied in the order they were added, without a forward call per update.
+* The RH_SV_WriteFullClientUpdate hooks see the rewritten userinfo.
+*
+* @param client         Client index whose userinfo is rewritten, 0 for any client
+* @param team           Team of the client, TEAM_UNASSIGNED for any team
+* @param receiverTeam   Team of the client receiving the update, TEAM_UNASSIGNED for anyone
+* @param key            Userinfo key
+* @param value          Value to set, unused by USERINFO_RULE_REMOVE
+* @param action         Look at the enum UserInfoRuleAction
+*
+* @note Team rules work only with ReGameDLL. Updates broadcasted to all clients don't match the receiver team rules.
+*
+* @return               Rule id, 0 on failure
+*
+* native rh_userinfo_add_rule(const client, const TeamName:team, const TeamName:receiverTeam, const key[], const value[] = "", const UserInfoRuleAction:action = USERINFO_RULE_SET);
+*/
+cell AMX_NATIVE_CALL rh_userinfo_add_rule(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_client, arg_team, arg_receiver_team, arg_key, arg_value, arg_action };
+
+	if (params[arg_client] != 0) {
+		CHECK_ISPLAYER(arg_client);
+	}
+
+	UserInfoRuleAction action = (PARAMS_COUNT >= 6) ? (UserInfoRuleAction)params[arg_action] : USERINFO_RULE_SET;
+	if (unlikely(action != USERINFO_RULE_SET && action != USERINFO_RULE_REMOVE)) {
+		AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: unknown action %d", __FUNCTION__, action);
+		return FALSE;
+	}
+
+	char keybuf[MAX_KV_LEN], valuebuf[MAX_KV_LEN];
+	const char *key = getAmxString(amx, params[arg_key], keybuf);
+	const char *value = (PARAMS_COUNT >= 5) ? getAmxString(amx, params[arg_value], valuebuf) : "";
+
+	if (unlikely(key[0] == '\0' || Q_strchr(key, '\\') || Q_strchr(value, '\\'))) {
+		AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: invalid key \"%s\" or value \"%s\"", __FUNCTION__, key, value);
+		return FALSE;
+	}
+
+	return g_userInfoRules.AddRule(params[arg_client], params[arg_team], params[arg_receiver_team], action, key, value);
+}
+
+/*
+* Removes a userinfo rule
+*
+* @param rule       Rule id returned by rh_userinfo_add_rule
+*
+* @return           true if the rule was removed, false otherwise
+*
+* native bool:rh_userinfo_remove_rule(const rule);
+*/
+cell AMX_NATIVE_CALL rh_userinfo_remove_rule(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_rule };
+
+	return g_userInfoRules.RemoveRule(params[arg_rule]) ? TRUE : FALSE;
+}
+
+/*
+* Removes all userinfo rules
+*
+* @noreturn
+*
+* native rh_userinfo_clear_rules();
+*/
+cell AMX_NATIVE_CALL rh_userinfo_clear_rules(AMX *amx, cell *params)
+{
+	g_userInfoRules.Clear();
+	return TRUE;
+}
+
+/*
+* Overrides the ping and loss of a client shown on the scoreboard.
+* The overrides are applied without a forward call per emission, after the RH_SV_EmitPings hooks.
+*
+* @param index          Client index
+* @param mode           Look at the enum PingOverrideMode, PING_OVERRIDE_NONE removes the override
+* @param ping           Ping to show, or the highest ping shown by PING_OVERRIDE_CLAMP
+* @param loss           Loss to show, or the highest loss shown by PING_OVERRIDE_CLAMP
+* @param visibleTo      Bitsum of the receiver teams (1 << _:TeamName) that see the override, 0 for everyone
+*
+* @note The override is removed when the client disconnects. Receiver teams work only with ReGameDLL.
+*
+* @noreturn
+*
+* native rh_set_ping_override(const index, const PingOverrideMode:mode, const ping = 0, const loss = 0, const visibleTo = 0);
+*/
+cell AMX_NATIVE_CALL rh_set_ping_override(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_index, arg_mode, arg_ping, arg_loss, arg_visible_to };
+
+	CHECK_ISPLAYER(arg_index);
+
+	PingOverrideMode mode = (PingOverrideMode)params[arg_mode];
+	if (unlikely(mode < PING_OVERRIDE_NONE || mode > PING_OVERRIDE_CLAMP)) {
+		AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: unknown mode %d", __FUNCTION__, mode);
+		return FALSE;
+	}
+
+	const int ping = (PARAMS_COUNT >= 3) ? params[arg_ping] : 0;
+	const int loss = (PARAMS_COUNT >= 4) ? params[arg_loss] : 0;
+	const int visibleTo = (PARAMS_COUNT >= 5) ? params[arg_visible_to] : 0;
+
+	g_pingOverrides.Set(params[arg_index], mode, ping, loss, visibleTo);
+	return TRUE;
+}
+
+/*
+* Gets the ping override of a client
+*
+* @param index          Client index
+* @param ping           Ping of the override
+* @param loss           Loss of the override
+* @param visibleTo      Bitsum of the receiver teams that see the override
+*
+* @return               Mode of the override, look at the enum PingOverrideMode
+*
+* native PingOverrideMode:rh_get_ping_override(const index, &ping = 0, &loss = 0, &visibleTo = 0);
+*/
+cell AMX_NATIVE_CALL rh_get_ping_override(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_index, arg_ping, arg_loss, arg_visible_to };
+
+	CHECK_ISPLAYER(arg_index);
+
+	int ping, loss, visibleTo;
+	PingOverrideMode mode = g_pingOverrides.Get(params[arg_index], ping, loss, visibleTo);
+
+	if (PARAMS_COUNT >= 2)
+		*getAmxAddr(amx, params[arg_ping]) = ping;
+
+	if (PARAMS_COUNT >= 3)
+		*getAmxAddr(amx, params[arg_loss]) = loss;
+
+	if (PARAMS_COUNT >= 4)
+		*getAmxAddr(amx, params[arg_visible_to]) = visibleTo;
+
+	return mode;
+}
+
+/*
+* Removes the ping overrides of all clients
+*
+* @noreturn
+*
+* native rh_clear_ping_overrides();
+*/
+cell AMX_NATIVE_CALL rh_clear_ping_overrides(AMX *amx, cell *params)
+{
+	g_pingOverrides.Clear();
+	return TRUE;
+}
+
+/*
+* Sets the largest distance at which the sounds of a channel are sent to a client.
+* Culled sounds are sent to every client separately, still restricted to the PAS of the sound,
+* and skipped for the clients farther than the distance.
+*
+* @param channel        Channel, look at the defines like CHAN_*
+* @param maxDistance    Audible distance, 0.0 removes the rule
+*
+* @note Static, stopped and unattenuated (ATTN_NONE) sounds are never culled.
+* @note The culling runs after the RH_SV_StartSound hooks.
+*
+* @noreturn
+*
+* native rh_sound_cull_channel(const channel, const Float:maxDistance);
+*/
+cell AMX_NATIVE_CALL rh_sound_cull_channel(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_channel, arg_distance };
+
+	if (unlikely(params[arg_channel] < 0 || params[arg_channel] >= SOUND_CULL_CHANNELS)) {
+		AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: invalid channel %d", __FUNCTION__, params[arg_channel]);
+		return FALSE;
+	}
+
+	CAmxArgs args(amx, params);
+	g_soundCulling.SetChannelDistance(params[arg_channel], args[arg_distance]);
+	return TRUE;
+}
+
+/*
+* Sets the largest distance at which the sounds whose sample starts with the prefix are sent to a client.
+* The longest matching prefix takes precedence over the rule of the channel.
+*
+* @param prefix         Sample prefix, case insensitive (e.g. "weapons/", "player/pl_step")
+* @param maxDistance    Audible distance, 0.0 removes the rule
+*
+* @noreturn
+*
+* native rh_sound_cull_prefix(const prefix[], const Float:maxDistance);
+*/
+cell AMX_NATIVE_CALL rh_sound_cull_prefix(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_prefix, arg_distance };
+
+	char prefixbuf[SOUND_CULL_MAX_PREFIX];
+	const char *prefix = getAmxString(amx, params[arg_prefix], prefixbuf);
+
+	if (unlikely(prefix[0] == '\0')) {
+		AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: empty prefix", __FUNCTION__);
+		return FALSE;
+	}
+
+	CAmxArgs args(amx, params);
+	g_soundCulling.SetPrefixDistance(prefix, args[arg_distance]);
+	return TRUE;
+}
+
+/*
+* Gets the counters of the sound culling
+*
+* @param sent       Amount of sounds sent to a single client
+* @param culled     Amount of sounds not sent to a client by distance or PAS
+* @param reset      Reset the counters
+*
+* @noreturn
+*
+* native rh_sound_cull_stats(&sent, &culled = 0, const bool:reset = false);
+*/
+cell AMX_NATIVE_CALL rh_sound_cull_stats(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_sent, arg_culled, arg_reset };
+
+	uint32 sent, culled;
+	g_soundCulling.GetStats(sent, culled);
+
+	*getAmxAddr(amx, params[arg_sent]) = sent;
+	*getAmxAddr(amx, params[arg_culled]) = culled;
+
+	if (params[arg_reset])
+		g_soundCulling.ResetStats();
+
+	return TRUE;
+}
+
+/*
+* Removes all sound culling rules
+*
+* @noreturn
+*
+* native rh_sound_cull_clear();
+*/
+cell AMX_NATIVE_CALL rh_sound_cull_clear(AMX *amx, cell *params)
+{
+	g_soundCulling.Clear();
+	return TRUE;
+}
+
+/*
+* Replaces or blocks a sound sample emitted through the engine (emit_sound, EMIT_SOUND_DYN in the game dll).
+* The table is looked up before the RH_SV_StartSound hooks, which see the replaced sample and never see the blocked ones.
+*
+* @param sample         Sample to replace, case insensitive
+* @param replacement    Replacing sample, it must be precached. An empty string blocks the sound.
+* @param classname      Only for sounds emitted by entities of this class, an empty string for any entity
+* @param receiverTeam   Only for clients of this team, TEAM_UNASSIGNED for everyone
+*
+* @note The most specific variant is used, the class takes precedence over the team.
+* @note Sounds with team variants are sent to every client separately and don't reach the RH_SV_StartSound hooks.
+*       Team variants work only with ReGameDLL.
+*
+* @noreturn
+*
+* native rh_sound_remap_set(const sample[], const replacement[], const classname[] = "", const TeamName:receiverTeam = TEAM_UNASSIGNED);
+*/
+cell AMX_NATIVE_CALL rh_sound_remap_set(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_sample, arg_replacement, arg_classname, arg_team };
+
+	char samplebuf[MAX_QPATH], replacementbuf[MAX_QPATH], classnamebuf[32];
+	const char *sample = getAmxString(amx, params[arg_sample], samplebuf);
+	const char *replacement = getAmxString(amx, params[arg_replacement], replacementbuf);
+	const char *classname = (PARAMS_COUNT >= 3) ? getAmxString(amx, params[arg_classname], classnamebuf) : "";
+	const int team = (PARAMS_COUNT >= 4) ? params[arg_team] : UNASSIGNED;
+
+	if (unlikely(sample[0] == '\0')) {
+		AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: empty sample", __FUNCTION__);
+		return FALSE;
+	}
+
+	g_soundRemap.Set(sample, classname, team, replacement);
+	return TRUE;
+}
+
+/*
+* Removes a variant of the sound remap table
+*
+* @param sample         Sample of the variant
+* @param classname      Class of the variant, an empty string for any entity
+* @param receiverTeam   Team of the variant, TEAM_UNASSIGNED for everyone
+*
+* @return               true if the variant was removed, false otherwise
+*
+* native bool:rh_sound_remap_remove(const sample[], const classname[] = "", const TeamName:receiverTeam = TEAM_UNASSIGNED);
+*/
+cell AMX_NATIVE_CALL rh_sound_remap_remove(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_sample, arg_classname, arg_team };
+
+	char samplebuf[MAX_QPATH], classnamebuf[32];
+	const char *sample = getAmxString(amx, params[arg_sample], samplebuf);
+	const char *classname = (PARAMS_COUNT >= 2) ? getAmxString(amx, params[arg_classname], classnamebuf) : "";
+	const int team = (PARAMS_COUNT >= 3) ? params[arg_team] : UNASSIGNED;
+
+	return g_soundRemap.Remove(sample, classname, team) ? TRUE : FALSE;
+}
+
+/*
+* Removes all variants of the sound remap table
+*
+* @noreturn
+*
+* native rh_sound_remap_clear();
+*/
+cell AMX_NATIVE_CALL rh_sound_remap_clear(AMX *amx, cell *params)
+{
+	g_soundRemap.Clear();
+	return TRUE;
+}
+
+/*
+* Blocks an event from being sent to clients. Both the queued events (playback_event) and the reliable ones are blocked.
+* The rules are checked before the RH_SV_EmitEvents and RH_EV_PlayReliableEvent hooks.
+*
+* @param eventindex     Event index returned by precache_event, 0 for any event
+* @param entity         Entity index the event is played from, 0 for any entity
+* @param receiver       Client index the event isn't sent to, 0 for every client
+*
+* @note The rules of a receiver are removed when it disconnects.
+*
+* @return               true if the rule was added, false if it already exists
+*
+* native bool:rh_event_filter_add(const eventindex, const entity = 0, const receiver = 0);
+*/
+cell AMX_NATIVE_CALL rh_event_filter_add(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_eventindex, arg_entity, arg_receiver };
+
+	const int entity = (PARAMS_COUNT >= 2) ? params[arg_entity] : 0;
+	const int receiver = (PARAMS_COUNT >= 3) ? params[arg_receiver] : 0;
+
+	if (receiver != 0) {
+		CHECK_ISPLAYER(arg_receiver);
+	}
+
+	if (unlikely(params[arg_eventindex] < 0 || entity < 0)) {
+		AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: invalid event %d or entity %d", __FUNCTION__, params[arg_eventindex], entity);
+		return FALSE;
+	}
+
+	return g_eventFilter.Add(params[arg_eventindex], entity, receiver) ? TRUE : FALSE;
+}
+
+/*
+* Removes an event filter rule
+*
+* @param eventindex     Event index of the rule
+* @param entity         Entity index of the rule
+* @param receiver       Client index of the rule
+*
+* @return               true if the rule was removed, false otherwise
+*
+* native bool:rh_event_filter_remove(const eventindex, const entity = 0, const receiver = 0);
+*/
+cell AMX_NATIVE_CALL rh_event_filter_remove(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_eventindex, arg_entity, arg_receiver };
+
+	const int entity = (PARAMS_COUNT >= 2) ? params[arg_entity] : 0;
+	const int receiver = (PARAMS_COUNT >= 3) ? params[arg_receiver] : 0;
+
+	if (receiver != 0) {
+		CHECK_ISPLAYER(arg_receiver);
+	}
+
+	return g_eventFilter.Remove(params[arg_eventindex], entity, receiver) ? TRUE : FALSE;
+}
+
+/*
+* Removes all event filter rules
+*
+* @noreturn
+*
+* native rh_event_filter_clear();
+*/
+cell AMX_NATIVE_CALL rh_event_filter_clear(AMX *amx, cell *params)
+{
+	g_eventFilter.Clear();
+	return TRUE;
+}
+
+/*
+* Starts sampling the network state of all clients (latency, loss, choke, rate, traffic) every N frames.
+* The samples are kept in a ring buffer of the last 64 samples per client, use rh_netmetrics_get to read the aggregates.
+* If a file is specified, every sample is written to it in the Prometheus text exposition format.
+* The file is replaced atomically, a reader never sees it partially written.
+*
+* @param frames     Sampling interval in server frames, 0 stops the sampler
+* @param file       Path relative to the game directory, e.g. "addons/amxmodx/data/netmetrics.prom", an empty string writes no file
+*
+* @note Writing a file at a high rate costs disk I/O in the server frame, choose the interval accordingly.
+*
+* @noreturn
+*
+* native rh_netmetrics_set(const frames, const file[] = "");
+*/
+cell AMX_NATIVE_CALL rh_netmetrics_set(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_frames, arg_file };
+
+	char filebuf[MAX_PATH];
+	const char *file = (PARAMS_COUNT >= 2) ? getAmxString(amx, params[arg_file], filebuf) : "";
+
+	g_netMetrics.SetInterval(params[arg_frames], file);
+	return TRUE;
+}
+
+/*
+* Gets an aggregate of the network samples
+*
+* @param index      Client index, 0 for the samples of all clients
+* @param metric     Look at the enum NetMetric
+* @param agg        Look at the enum NetMetricAgg
+* @param value      Variable to store the value in
+*
+* @return           true if there are samples to aggregate, false otherwise
+*
+* native bool:rh_netmetrics_get(const index, const NetMetric:metric, const NetMetricAgg:agg, &Float:value);
+*/
+cell AMX_NATIVE_CALL rh_netmetrics_get(AMX *amx, cell *params)
+{
+	enum args_e { arg_count, arg_index, arg_metric, arg_agg, arg_value };
+
+	if (params[arg_index] != 0) {
+		CHECK_ISPLAYER(arg_index);
+	}
+
+	if (unlikely(params[arg_metric] < 0 || params[arg_metric] >= NET_METRIC_COUNT)) {
+		AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: unknown metric %d", __FUNCTION__, params[arg_metric]);
+		return FALSE;
+	}
+
+	if (unlikely(params[arg_agg] < NET_AGG_LAST || params[arg_agg] > NET_AGG_MAX)) {
+		AMXX_LogError(amx, AMX_ERR_NATIVE, "%s: unknown aggregate %d", __FUNCTION__, params[arg_agg]);
+		return FALSE;
+	}
+
+	float value;
+	if (!g_netMetrics.GetAggregate(params[arg_index], (NetMetric)params[arg_metric], (NetMetricAgg)params[arg_agg], value))
+		return FALSE;
+
+	*(float *)getAmxAddr(amx, params[arg_value]) = value;
+	return TRUE;
+}
+
+/*
+* Drops the network samples collected so far
+*
+* @noreturn
+*
+* native rh_netmetrics_reset();
+*/
+cell AMX_NATIVE_CALL rh_netmetrics_reset(AMX *amx, cell *params)
+{
+	g_netMetrics.Reset();
+	return TRUE;
+}
+
 AMX_NATIVE_INFO Misc_Natives_RH[] =
 {
 	{ "rh_set_mapname",             rh_set_mapname             },
@@ -3901,6 +4813,33 @@ AMX_NATIVE_INFO Misc_Natives_RH[] =
 	{ "rh_get_client_connect_time", rh_get_client_connect_time },
 	{ "rh_is_server_paused",        rh_is_server_paused        },
 	{ "rh_set_server_pause",        rh_set_server_pause        },
+	{ "rh_lagcomp_set_history",     rh_lagcomp_set_history     },
+	{ "rh_lagcomp_rewind",          rh_lagcomp_rewind          },
+	{ "rh_lagcomp_get_view_time",   rh_lagcomp_get_view_time   },
+	{ "rh_packet_limiter_set",      rh_packet_limiter_set      },
+	{ "rh_packet_limiter_stats",    rh_packet_limiter_stats    },
+	{ "rh_stringcmd_limiter_set",   rh_stringcmd_limiter_set   },
+	{ "rh_stringcmd_set_cost",      rh_stringcmd_set_cost      },
+	{ "rh_stringcmd_stats",         rh_stringcmd_stats         },
+	{ "rh_userinfo_add_rule",       rh_userinfo_add_rule       },
+	{ "rh_userinfo_remove_rule",    rh_userinfo_remove_rule    },
+	{ "rh_userinfo_clear_rules",    rh_userinfo_clear_rules    },
+	{ "rh_set_ping_override",       rh_set_ping_override       },
+	{ "rh_get_ping_override",       rh_get_ping_override       },
+	{ "rh_clear_ping_overrides",    rh_clear_ping_overrides    },
+	{ "rh_sound_cull_channel",      rh_sound_cull_channel      },
+	{ "rh_sound_cull_prefix",       rh_sound_cull_prefix       },
+	{ "rh_sound_cull_stats",        rh_sound_cull_stats        },
+	{ "rh_sound_cull_clear",        rh_sound_cull_clear        },
+	{ "rh_sound_remap_set",         rh_sound_remap_set         },
+	{ "rh_sound_remap_remove",      rh_sound_remap_remove      },
+	{ "rh_sound_remap_clear",       rh_sound_remap_clear       },
+	{ "rh_event_filter_add",        rh_event_filter_add        },
+	{ "rh_event_filter_remove",     rh_event_filter_remove     },
+	{ "rh_event_filter_clear",      rh_event_filter_clear      },
+	{ "rh_netmetrics_set",          rh_netmetrics_set          },
+	{ "rh_netmetrics_get",          rh_netmetrics_get          },
+	{ "rh_netmetrics_reset",        rh_netmetrics_reset        },
 
 	{ nullptr, nullptr }
 };
@@ -0,0 +1,168 @@
+#include "precompiled.h"
+
+CNetMetrics g_netMetrics;
+
+void CNetMetrics::SetInterval(int frames, const char *path)
+{
+	m_interval = max(frames, 0);
+	m_frames = 0;
+
+	if (path[0] != '\0')
+		g_amxxapi.BuildPathnameR(m_path, sizeof(m_path), "%s", path);
+	else
+		m_path[0] = '\0';
+}
+
+void CNetMetrics::Reset()
+{
+	memset(m_samples, 0, sizeof(m_samples));
+	m_current = -1;
+	m_numSamples = 0;
+}
+
+void CNetMetrics::Clear()
+{
+	m_interval = 0;
+	m_path[0] = '\0';
+	Reset();
+}
+
+void CNetMetrics::Sample()
+{
+	if (!m_interval || ++m_frames < m_interval)
+		return;
+
+	m_frames = 0;
+	m_current = (m_current + 1) % NETMETRICS_HISTORY;
+	m_numSamples = min(m_numSamples + 1, NETMETRICS_HISTORY);
+
+	sample_t *row = m_samples[m_current];
+
+	const int maxClients = min(gpGlobals->maxClients, MAX_CLIENTS);
+	for (int i = 0; i < MAX_CLIENTS; i++)
+	{
+		sample_t &sample = row[i];
+
+		client_t *pClient = (i < maxClients) ? g_RehldsSvs->GetClient_t(i) : nullptr;
+		if (!pClient || !pClient->active || pClient->fakeclient)
+		{
+			sample.userid = 0;
+			continue;
+		}
+
+		const netchan_t &chan = pClient->netchan;
+
+		sample.userid = pClient->userid;
+		sample.values[NET_METRIC_LATENCY] = pClient->latency * 1000.0f;
+		sample.values[NET_METRIC_LOSS]    = pClient->packet_loss;
+		sample.values[NET_METRIC_CHOKE]   = float(pClient->chokecount);
+		sample.values[NET_METRIC_RATE]    = float(chan.rate);
+		sample.values[NET_METRIC_IN]      = chan.flow[FLOW_INCOMING].avgkbytespersec * 1024.0f;
+		sample.values[NET_METRIC_OUT]     = chan.flow[FLOW_OUTGOING].avgkbytespersec * 1024.0f;
+	}
+
+	if (m_path[0] != '\0')
+		Write();
+}
+
+bool CNetMetrics::GetAggregate(int index, NetMetric metric, NetMetricAgg agg, float &value) const
+{
+	if (m_current == -1)
+		return false;
+
+	// the samples of a client are those taken since it took the slot
+	int userid = 0;
+	if (index)
+	{
+		userid = m_samples[m_current][index - 1].userid;
+		if (!userid)
+			return false;
+	}
+
+	int count = 0;
+	double sum = 0.0;
+
+	for (int n = 0; n < m_numSamples; n++)
+	{
+		const sample_t *row = m_samples[(m_current - n + NETMETRICS_HISTORY) % NETMETRICS_HISTORY];
+
+		for (int i = (index ? index - 1 : 0); i < (index ? index : MAX_CLIENTS); i++)
+		{
+			if (!row[i].userid || (userid && row[i].userid != userid))
+				continue;
+
+			const float v = row[i].values[metric];
+			switch (agg)
+			{
+			case NET_AGG_MIN: value = count ? min(value, v) : v; break;
+			case NET_AGG_MAX: value = count ? max(value, v) : v; break;
+			default:          sum += v; break;
+			}
+
+			count++;
+		}
+
+		// only the last sample of every client
+		if (agg == NET_AGG_LAST)
+			break;
+	}
+
+	if (!count)
+		return false;
+
+	if (agg == NET_AGG_LAST || agg == NET_AGG_AVG)
+		value = float(sum / count);
+
+	return true;
+}
+
+void CNetMetrics::Write() const
+{
+	static const struct
+	{
+		const char *name;
+		const char *help;
+	} metrics[NET_METRIC_COUNT] =
+	{
+		{ "reapi_client_latency_ms",       "Latency of the client in milliseconds" },
+		{ "reapi_client_loss_percent",     "Packet loss of the client" },
+		{ "reapi_client_choke",            "Packets choked since the last update sent to the client" },
+		{ "reapi_client_rate_bytes",       "Rate of the client in bytes per second" },
+		{ "reapi_client_in_bytes",         "Bytes per second received from the client" },
+		{ "reapi_client_out_bytes",        "Bytes per second sent to the client" },
+	};
+
+	char tmppath[MAX_PATH];
+	Q_snprintf(tmppath, sizeof(tmppath), "%s.tmp", m_path);
+
+	FILE *fp = fopen(tmppath, "wt");
+	if (!fp)
+		return;
+
+	const sample_t *row = m_samples[m_current];
+	for (int metric = 0; metric < NET_METRIC_COUNT; metric++)
+	{
+		fprintf(fp, "# HELP %s %s\n# TYPE %s gauge\n", metrics[metric].name, metrics[metric].help, metrics[metric].name);
+
+		for (int i = 0; i < MAX_CLIENTS; i++)
+		{
+			if (row[i].userid)
+				fprintf(fp, "%s{client=\"%d\",userid=\"%d\"} %.1f\n", metrics[metric].name, i + 1, row[i].userid, row[i].values[metric]);
+		}
+	}
+
+	const bool failed = ferror(fp) != 0;
+	fclose(fp);
+
+	if (failed)
+	{
+		remove(tmppath);
+		return;
+	}
+
+#ifdef _WIN32
+	MoveFileExA(tmppath, m_path, MOVEFILE_REPLACE_EXISTING);
+#else
+	rename(tmppath, m_path);
+#endif
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#define NETMETRICS_HISTORY      64      // samples kept per client
+
+// sampled values
+enum NetMetric
+{
+	NET_METRIC_LATENCY = 0,     // ms
+	NET_METRIC_LOSS,            // percents
+	NET_METRIC_CHOKE,           // packets choked since the last update sent to the client
+	NET_METRIC_RATE,            // bytes per second allowed by the rate of the client
+	NET_METRIC_IN,              // bytes per second received from the client
+	NET_METRIC_OUT,             // bytes per second sent to the client
+
+	NET_METRIC_COUNT
+};
+
+// aggregations over the sample window
+enum NetMetricAgg
+{
+	NET_AGG_LAST = 0,
+	NET_AGG_AVG,
+	NET_AGG_MIN,
+	NET_AGG_MAX,
+};
+
+// Samples the network state of all clients every N frames into a ring buffer
+// and optionally writes the last sample to a metrics file in the Prometheus text format.
+// The file is written to a temporary one first and renamed, readers never see a partial file.
+class CNetMetrics
+{
+public:
+	CNetMetrics() { Clear(); }
+
+	// An interval of 0 stops the sampler. path is relative to the game directory, an empty one writes no file.
+	void SetInterval(int frames, const char *path);
+
+	// Called every frame
+	void Sample();
+
+	// Aggregate of the samples in the ring buffer, of all clients if index is 0
+	bool GetAggregate(int index, NetMetric metric, NetMetricAgg agg, float &value) const;
+
+	// Drops the samples, keeps the interval and the file
+	void Reset();
+
+	// Stops the sampler and drops the samples
+	void Clear();
+
+private:
+	struct sample_t
+	{
+		int userid;         // 0 if the client wasn't sampled
+		float values[NET_METRIC_COUNT];
+	};
+
+	void Write() const;
+
+	int m_interval = 0;
+	int m_frames = 0;
+	char m_path[MAX_PATH];
+
+	int m_current;          // last written row of the ring
+	int m_numSamples;
+	sample_t m_samples[NETMETRICS_HISTORY][MAX_CLIENTS];
+};
+
+extern CNetMetrics g_netMetrics;
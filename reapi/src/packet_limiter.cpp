@@ -0,0 +1,219 @@
+#include "precompiled.h"
+
+CPacketLimiter g_packetLimiter;
+
+void CPacketLimiter::SetRate(float rate, float burst, int maxSources)
+{
+	m_rate = max(rate, 0.0f);
+	m_burst = max(burst, 1.0f);
+
+	if (!IsEnabled())
+	{
+		Clear();
+		return;
+	}
+
+	const size_t size = clamp(maxSources, 1, PACKET_LIMITER_MAX_SOURCES);
+	if (size != m_maxSources || m_hash.empty())
+	{
+		m_maxSources = size;
+		m_sources.clear();
+		m_sources.reserve(m_maxSources);
+
+		// power of two, at least twice the amount of sources
+		size_t buckets = 1;
+		while (buckets < m_maxSources * 2)
+			buckets <<= 1;
+
+		m_hash.assign(buckets, -1);
+		m_head = m_tail = -1;
+	}
+
+	if (!m_hooked)
+	{
+		g_RehldsHookchains->PreprocessPacket()->registerHook(&PreprocessPacket);
+		g_RehldsHookchains->SV_CheckConnectionLessRateLimits()->registerHook(&SV_CheckConnectionLessRateLimits);
+		m_hooked = true;
+	}
+}
+
+void CPacketLimiter::Unlink(int index)
+{
+	source_t &source = m_sources[index];
+
+	if (source.prev != -1)
+		m_sources[source.prev].next = source.next;
+	else
+		m_head = source.next;
+
+	if (source.next != -1)
+		m_sources[source.next].prev = source.prev;
+	else
+		m_tail = source.prev;
+}
+
+void CPacketLimiter::LinkHead(int index)
+{
+	source_t &source = m_sources[index];
+
+	source.prev = -1;
+	source.next = m_head;
+
+	if (m_head != -1)
+		m_sources[m_head].prev = index;
+	else
+		m_tail = index;
+
+	m_head = index;
+}
+
+void CPacketLimiter::RemoveFromHash(int index)
+{
+	int *link = &m_hash[Hash(m_sources[index].ip)];
+	while (*link != index)
+		link = &m_sources[*link].hnext;
+
+	*link = m_sources[index].hnext;
+}
+
+CPacketLimiter::source_t *CPacketLimiter::GetSource(uint32 ip)
+{
+	int &bucket = m_hash[Hash(ip)];
+
+	for (int index = bucket; index != -1; index = m_sources[index].hnext)
+	{
+		if (m_sources[index].ip != ip)
+			continue;
+
+		// move to the front of the LRU list
+		if (index != m_head)
+		{
+			Unlink(index);
+			LinkHead(index);
+		}
+
+		return &m_sources[index];
+	}
+
+	int index;
+	if (m_sources.size() < m_maxSources)
+	{
+		index = m_sources.size();
+		m_sources.emplace_back();
+	}
+	else
+	{
+		// reuse the least recently seen source
+		index = m_tail;
+		Unlink(index);
+		RemoveFromHash(index);
+		m_evicted++;
+	}
+
+	source_t &source = m_sources[index];
+	source.ip = ip;
+	source.tokens = m_burst;
+	source.updated = g_RehldsFuncs->GetRealTime();
+
+	// the bucket may have been changed by RemoveFromHash
+	int &head = m_hash[Hash(ip)];
+	source.hnext = head;
+	head = index;
+
+	LinkHead(index);
+	return &source;
+}
+
+void CPacketLimiter::Refill(source_t *source, double now) const
+{
+	if (now <= source->updated)
+		return;
+
+	source->tokens = min(m_burst, source->tokens + float((now - source->updated) * m_rate));
+	source->updated = now;
+}
+
+bool CPacketLimiter::CanAccept(const netadr_t &adr)
+{
+	if (adr.type != NA_IP)
+		return true;
+
+	source_t *source = GetSource(GetIP(adr));
+	Refill(source, g_RehldsFuncs->GetRealTime());
+
+	if (source->tokens >= 1.0f)
+		return true;
+
+	m_dropped++;
+	return false;
+}
+
+bool CPacketLimiter::Accept(const netadr_t &adr)
+{
+	if (adr.type != NA_IP)
+		return true;
+
+	source_t *source = GetSource(GetIP(adr));
+	Refill(source, g_RehldsFuncs->GetRealTime());
+
+	if (source->tokens < 1.0f)
+	{
+		m_dropped++;
+		return false;
+	}
+
+	source->tokens -= 1.0f;
+	m_accepted++;
+	return true;
+}
+
+void CPacketLimiter::GetStats(stats_t &stats) const
+{
+	stats.accepted = m_accepted;
+	stats.dropped = m_dropped;
+	stats.evicted = m_evicted;
+	stats.sources = m_sources.size();
+}
+
+void CPacketLimiter::ResetStats()
+{
+	m_accepted = 0;
+	m_dropped = 0;
+	m_evicted = 0;
+}
+
+void CPacketLimiter::Clear()
+{
+	if (m_hooked)
+	{
+		g_RehldsHookchains->PreprocessPacket()->unregisterHook(&PreprocessPacket);
+		g_RehldsHookchains->SV_CheckConnectionLessRateLimits()->unregisterHook(&SV_CheckConnectionLessRateLimits);
+		m_hooked = false;
+	}
+
+	m_rate = 0.0f;
+	m_sources.clear();
+	m_hash.clear();
+	m_head = m_tail = -1;
+}
+
+// Drops connectionless packets of sources with an empty bucket before the engine parses them
+bool CPacketLimiter::PreprocessPacket(IRehldsHook_PreprocessPacket *chain, uint8 *data, unsigned int len, const netadr_t &adr)
+{
+	if (g_packetLimiter.IsEnabled() && len >= 4 && *(uint32 *)data == 0xFFFFFFFF)
+	{
+		if (!g_packetLimiter.CanAccept(adr))
+			return false;
+	}
+
+	return chain->callNext(data, len, adr);
+}
+
+// The token is taken once the engine is going to answer the packet
+bool CPacketLimiter::SV_CheckConnectionLessRateLimits(IRehldsHook_SV_CheckConnectionLessRateLimits *chain, netadr_t &adr, const uint8_t *data, int len)
+{
+	if (g_packetLimiter.IsEnabled() && !g_packetLimiter.Accept(adr))
+		return false;
+
+	return chain->callNext(adr, data, len);
+}
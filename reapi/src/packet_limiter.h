@@ -0,0 +1,73 @@
+#pragma once
+
+#define PACKET_LIMITER_DEFAULT_SOURCES  4096
+#define PACKET_LIMITER_MAX_SOURCES      65536
+
+// Token bucket per source address for connectionless packets (queries, getchallenge, connect),
+// packets over the rate are dropped in the engine hooks before any plugin forward is involved.
+// The sources are kept in a bounded table, the least recently seen one is evicted when it's full.
+class CPacketLimiter
+{
+public:
+	struct stats_t
+	{
+		uint32 accepted;
+		uint32 dropped;
+		uint32 evicted;     // sources evicted from the table to make room for new ones
+		int sources;        // sources in the table
+	};
+
+	// A rate of 0 disables the limiter
+	void SetRate(float rate, float burst, int maxSources);
+	bool IsEnabled() const { return m_rate > 0.0f; }
+
+	// Checks the bucket of the source without taking a token
+	bool CanAccept(const netadr_t &adr);
+
+	// Takes a token from the bucket of the source, returns false if it's empty
+	bool Accept(const netadr_t &adr);
+
+	void GetStats(stats_t &stats) const;
+	void ResetStats();
+
+	// Unregisters the engine hooks
+	void Clear();
+
+private:
+	static bool PreprocessPacket(IRehldsHook_PreprocessPacket *chain, uint8 *data, unsigned int len, const netadr_t &adr);
+	static bool SV_CheckConnectionLessRateLimits(IRehldsHook_SV_CheckConnectionLessRateLimits *chain, netadr_t &adr, const uint8_t *data, int len);
+
+	struct source_t
+	{
+		uint32 ip;
+		float tokens;
+		double updated;     // realtime of the last refill
+		int hnext;          // next source in the hash chain
+		int prev, next;     // links in the LRU list, head is the most recent
+	};
+
+	source_t *GetSource(uint32 ip);
+	void Refill(source_t *source, double now) const;
+
+	void Unlink(int index);
+	void LinkHead(int index);
+	void RemoveFromHash(int index);
+
+	static uint32 GetIP(const netadr_t &adr) { return *(const uint32 *)adr.ip; }
+	uint32 Hash(uint32 ip) const { return (ip * 2654435761u) & (m_hash.size() - 1); }
+
+	bool m_hooked = false;
+	float m_rate = 0.0f;
+	float m_burst = 0.0f;
+	size_t m_maxSources = PACKET_LIMITER_DEFAULT_SOURCES;
+
+	std::vector<source_t> m_sources;
+	std::vector<int> m_hash;
+	int m_head = -1, m_tail = -1;
+
+	uint32 m_accepted = 0;
+	uint32 m_dropped = 0;
+	uint32 m_evicted = 0;
+};
+
+extern CPacketLimiter g_packetLimiter;
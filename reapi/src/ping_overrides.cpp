@@ -0,0 +1,142 @@
+#include "precompiled.h"
+
+CPingOverrides g_pingOverrides;
+
+CPingOverrides::CPingOverrides()
+{
+	memset(m_overrides, 0, sizeof(m_overrides));
+}
+
+void CPingOverrides::Set(int index, PingOverrideMode mode, int ping, int loss, int visibleTo)
+{
+	override_t &entry = m_overrides[index - 1];
+
+	if (entry.mode != PING_OVERRIDE_NONE)
+		m_numOverrides--;
+
+	entry.userid = clientOfIndex(index)->userid;
+	entry.mode = mode;
+	entry.ping = clamp(ping, 0, 4095);  // 12 bits
+	entry.loss = clamp(loss, 0, 127);   // 7 bits
+	entry.visibleTo = visibleTo;
+
+	if (entry.mode != PING_OVERRIDE_NONE)
+		m_numOverrides++;
+
+	UpdateHook();
+}
+
+PingOverrideMode CPingOverrides::Get(int index, int &ping, int &loss, int &visibleTo) const
+{
+	const override_t &entry = m_overrides[index - 1];
+
+	if (entry.mode == PING_OVERRIDE_NONE || entry.userid != clientOfIndex(index)->userid)
+	{
+		ping = loss = visibleTo = 0;
+		return PING_OVERRIDE_NONE;
+	}
+
+	ping = entry.ping;
+	loss = entry.loss;
+	visibleTo = entry.visibleTo;
+	return entry.mode;
+}
+
+void CPingOverrides::Clear()
+{
+	memset(m_overrides, 0, sizeof(m_overrides));
+	m_numOverrides = 0;
+
+	UpdateHook();
+}
+
+void CPingOverrides::UpdateHook()
+{
+	const bool hook = m_numOverrides > 0;
+	if (hook == m_hooked)
+		return;
+
+	// after the reapi hook, the entries are patched in the message the engine has written
+	if (hook)
+		g_RehldsHookchains->SV_EmitPings()->registerHook(&SV_EmitPings, HC_PRIORITY_LOW);
+	else
+		g_RehldsHookchains->SV_EmitPings()->unregisterHook(&SV_EmitPings);
+
+	m_hooked = hook;
+}
+
+// the bits of svc_pings are written starting from the low bit of each byte
+static uint32 ReadBits(const byte *data, int &bit, int numbits)
+{
+	uint32 value = 0;
+	for (int i = 0; i < numbits; i++, bit++)
+		value |= ((data[bit >> 3] >> (bit & 7)) & 1) << i;
+
+	return value;
+}
+
+static void WriteBits(byte *data, int bit, uint32 value, int numbits)
+{
+	for (int i = 0; i < numbits; i++, bit++)
+	{
+		if (value & (1 << i))
+			data[bit >> 3] |= 1 << (bit & 7);
+		else
+			data[bit >> 3] &= ~(1 << (bit & 7));
+	}
+}
+
+void CPingOverrides::Patch(IGameClient *receiver, byte *data, int size) const
+{
+	int receiverTeam = -1;
+
+	// every entry is a bit set, 5 bits of the slot, 12 bits of ping and 7 bits of loss,
+	// the values are the ones the engine refreshes every 2 seconds
+	int bit = 0;
+	while (bit + 25 <= size * 8 && ReadBits(data, bit, 1))
+	{
+		const int slot = ReadBits(data, bit, 5);
+		const int pingBit = bit;
+
+		int ping = ReadBits(data, bit, 12);
+		int loss = ReadBits(data, bit, 7);
+
+		const override_t &entry = m_overrides[slot];
+		if (entry.mode == PING_OVERRIDE_NONE || entry.userid != clientOfIndex(slot + 1)->userid)
+			continue;
+
+		if (entry.visibleTo)
+		{
+			if (receiverTeam == -1)
+				receiverTeam = GetPlayerTeam(receiver->GetEdict());
+
+			if (!(entry.visibleTo & (1 << receiverTeam)))
+				continue;
+		}
+
+		if (entry.mode == PING_OVERRIDE_FIXED)
+		{
+			ping = entry.ping;
+			loss = entry.loss;
+		}
+		else
+		{
+			ping = min(ping, entry.ping);
+			loss = min(loss, entry.loss);
+		}
+
+		WriteBits(data, pingBit, ping, 12);
+		WriteBits(data, pingBit + 12, loss, 7);
+	}
+}
+
+void CPingOverrides::SV_EmitPings(IRehldsHook_SV_EmitPings *chain, IGameClient *cl, sizebuf_t *msg)
+{
+	const int start = msg->cursize;
+	chain->callNext(cl, msg);
+
+	if ((msg->flags & SIZEBUF_OVERFLOWED) || msg->cursize <= start + 1 || msg->data[start] != SVC_PINGS)
+		return;
+
+	g_pingOverrides.Patch(cl, &msg->data[start + 1], msg->cursize - start - 1);
+}
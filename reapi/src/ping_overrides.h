@@ -0,0 +1,48 @@
+#pragma once
+
+#define SVC_PINGS   17      // svc_pings
+
+// how the override is applied
+enum PingOverrideMode
+{
+	PING_OVERRIDE_NONE = 0,     // the real values are shown
+	PING_OVERRIDE_FIXED,        // the values of the override are shown
+	PING_OVERRIDE_CLAMP,        // the real values are capped at the values of the override
+};
+
+// Ping and loss shown on the scoreboard, overridden per client without an AMX call per emission.
+// While any override is set the entries of the overridden clients are rewritten in the svc_pings
+// the engine has written, after the RH_SV_EmitPings forwards. The other entries are left as they are.
+class CPingOverrides
+{
+public:
+	CPingOverrides();
+
+	// visibleTo is a bitsum of receiver teams (1 << team) that see the override, 0 for everyone
+	void Set(int index, PingOverrideMode mode, int ping, int loss, int visibleTo);
+	PingOverrideMode Get(int index, int &ping, int &loss, int &visibleTo) const;
+
+	// Removes all overrides and unregisters the engine hook
+	void Clear();
+
+private:
+	static void SV_EmitPings(IRehldsHook_SV_EmitPings *chain, IGameClient *cl, sizebuf_t *msg);
+
+	void Patch(IGameClient *receiver, byte *data, int size) const;
+	void UpdateHook();
+
+	struct override_t
+	{
+		int userid;         // the override is dropped when another client takes the slot
+		PingOverrideMode mode;
+		int ping;
+		int loss;
+		int visibleTo;
+	};
+
+	bool m_hooked = false;
+	int m_numOverrides = 0;
+	override_t m_overrides[MAX_CLIENTS];
+};
+
+extern CPingOverrides g_pingOverrides;
@@ -0,0 +1,97 @@
+#include "precompiled.h"
+
+CPlayerSnapshot g_playerSnapshot;
+
+void CPlayerSnapshot::Update()
+{
+	if (likely(m_valid))
+		return;
+
+	Refresh();
+	m_valid = true;
+}
+
+void CPlayerSnapshot::Refresh()
+{
+	m_numConnected = 0;
+	m_connectedBits = 0;
+	m_aliveBits = 0;
+	memset(m_teamBits, 0, sizeof(m_teamBits));
+
+	const int maxClients = min(gpGlobals->maxClients, MAX_CLIENTS);
+
+	for (int i = 0; i <= MAX_CLIENTS; i++)
+	{
+		CBasePlayer *pPlayer = (i > 0 && i <= maxClients) ? UTIL_PlayerByIndex(i) : nullptr;
+		if (!pPlayer || pPlayer->has_disconnected)
+		{
+			m_origin[i]   = Vector(0, 0, 0);
+			m_velocity[i] = Vector(0, 0, 0);
+			m_health[i]   = 0.0f;
+			m_armor[i]    = 0.0f;
+			m_team[i]     = UNASSIGNED;
+			m_alive[i]    = FALSE;
+			m_flags[i]    = 0;
+			m_weapon[i]   = WEAPON_NONE;
+			m_money[i]    = 0;
+			continue;
+		}
+
+		entvars_t *pev = pPlayer->pev;
+		const int bit = 1 << (i & 31);
+
+		m_origin[i]   = pev->origin;
+		m_velocity[i] = pev->velocity;
+		m_health[i]   = pev->health;
+		m_armor[i]    = pev->armorvalue;
+		m_team[i]     = pPlayer->m_iTeam;
+		m_alive[i]    = pPlayer->IsAlive() ? TRUE : FALSE;
+		m_flags[i]    = pev->flags;
+		m_weapon[i]   = pPlayer->m_pActiveItem ? pPlayer->m_pActiveItem->m_iId : WEAPON_NONE;
+		m_money[i]    = pPlayer->m_iAccount;
+
+		m_numConnected++;
+		m_connectedBits |= bit;
+
+		if (m_alive[i])
+			m_aliveBits |= bit;
+
+		if (m_team[i] >= UNASSIGNED && m_team[i] <= SPECTATOR)
+			m_teamBits[m_team[i]] |= bit;
+	}
+}
+
+size_t CPlayerSnapshot::CopyColumn(PlayerStateColumn column, cell *dest, size_t count) const
+{
+	count = min(count, (size_t)MAX_CLIENTS + 1);
+
+	const void *src;
+	size_t cells = count;
+
+	switch (column)
+	{
+	case PSC_ORIGIN:   src = m_origin;   cells *= 3; break;
+	case PSC_VELOCITY: src = m_velocity; cells *= 3; break;
+	case PSC_HEALTH:   src = m_health;   break;
+	case PSC_ARMOR:    src = m_armor;    break;
+	case PSC_TEAM:     src = m_team;     break;
+	case PSC_ALIVE:    src = m_alive;    break;
+	case PSC_FLAGS:    src = m_flags;    break;
+	case PSC_WEAPON:   src = m_weapon;   break;
+	case PSC_MONEY:    src = m_money;    break;
+	default:
+		return 0;
+	}
+
+	// all columns are made of 4-byte values, same as cell
+	memcpy(dest, src, cells * sizeof(cell));
+	return cells;
+}
+
+int CPlayerSnapshot::GetTeamBits(TeamName team) const
+{
+	if (team < UNASSIGNED || team > SPECTATOR)
+		return 0;
+
+	return m_teamBits[team];
+}
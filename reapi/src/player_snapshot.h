@@ -0,0 +1,61 @@
+#pragma once
+
+// Columns of the player state snapshot
+enum PlayerStateColumn
+{
+	PSC_ORIGIN   = BIT(0), // Vector
+	PSC_VELOCITY = BIT(1), // Vector
+	PSC_HEALTH   = BIT(2), // float
+	PSC_ARMOR    = BIT(3), // float
+	PSC_TEAM     = BIT(4), // TeamName
+	PSC_ALIVE    = BIT(5), // bool
+	PSC_FLAGS    = BIT(6), // int
+	PSC_WEAPON   = BIT(7), // WeaponIdType
+	PSC_MONEY    = BIT(8), // int
+
+	PSC_ALL      = BIT(9) - 1
+};
+
+// Packed per-frame copy of the hot player fields, stored column by column
+// so that a whole column can be handed over to AMX with a single copy.
+class CPlayerSnapshot
+{
+public:
+	// Marks the snapshot as outdated, it's refreshed on the next access
+	void Invalidate() { m_valid = false; }
+
+	// Refreshes the snapshot if it was not yet done in this frame
+	void Update();
+
+	// Copies a column for the clients [0, count), returns the amount of cells written
+	size_t CopyColumn(PlayerStateColumn column, cell *dest, size_t count) const;
+
+	// Bits are set as 1 << (index & 31)
+	int GetConnectedBits() const      { return m_connectedBits; }
+	int GetAliveBits() const          { return m_aliveBits; }
+	int GetTeamBits(TeamName team) const;
+
+	int GetNumConnected() const       { return m_numConnected; }
+
+private:
+	void Refresh();
+
+	bool m_valid = false;
+
+	int m_numConnected;
+	int m_connectedBits;
+	int m_aliveBits;
+	int m_teamBits[SPECTATOR + 1];
+
+	Vector m_origin[MAX_CLIENTS + 1];
+	Vector m_velocity[MAX_CLIENTS + 1];
+	float m_health[MAX_CLIENTS + 1];
+	float m_armor[MAX_CLIENTS + 1];
+	int m_team[MAX_CLIENTS + 1];
+	int m_alive[MAX_CLIENTS + 1];
+	int m_flags[MAX_CLIENTS + 1];
+	int m_weapon[MAX_CLIENTS + 1];
+	int m_money[MAX_CLIENTS + 1];
+};
+
+extern CPlayerSnapshot g_playerSnapshot;
@@ -63,6 +63,25 @@
 #include "hook_callback.h"
 #include "entity_callback_dispatcher.h"
 #include "member_list.h"
+#include "player_snapshot.h"
+#include "bone_cache.h"
+#include "studio_cache.h"
+#include "lag_compensation.h"
+#include "timer_wheel.h"
+#include "job_scheduler.h"
+#include "entity_data.h"
+#include "entity_pool.h"
+#include "entity_removal.h"
+#include "packet_limiter.h"
+#include "stringcmd_limiter.h"
+#include "userinfo_rules.h"
+#include "ping_overrides.h"
+#include "sound_culling.h"
+#include "sound_remap.h"
+#include "event_filter.h"
+#include "net_metrics.h"
+#include "message_deferral.h"
+#include "voice_matrix.h"
 
 // natives
 #include "natives_hookchains.h"
@@ -46,22 +46,53 @@ ModelName GetModelAuto(TeamName team)
 CTempStrings::CTempStrings()
 {
 	m_current = 0;
+	m_used = 0;
+	m_depth = 0;
 }
 
+CTempStrings::~CTempStrings()
+{
+	for (auto& chunk : m_chunks)
+		delete [] chunk.data;
+
+	m_chunks.clear();
+}
 
-char* CTempStrings::push(AMX* amx)
+char* CTempStrings::alloc(size_t size)
 {
-	if (m_current == STRINGS_MAX) {
-		AMXX_LogError(amx, AMX_ERR_NATIVE, "temp strings limit exceeded, contact reapi authors");
-		return nullptr;
+	for (; m_current < m_chunks.size(); m_current++, m_used = 0)
+	{
+		auto& chunk = m_chunks[m_current];
+		if (chunk.size - m_used >= size)
+		{
+			char *ptr = chunk.data + m_used;
+			m_used += size;
+			return ptr;
+		}
 	}
 
-	return m_strings[m_current++];
+	chunk_t chunk;
+	chunk.size = max(size, (size_t)CHUNK_SIZE);
+	chunk.data = new char[chunk.size];
+	m_chunks.push_back(chunk);
+
+	m_used = size;
+	return chunk.data;
+}
+
+void CTempStrings::enter()
+{
+	m_depth++;
 }
 
-void CTempStrings::pop(size_t count)
+void CTempStrings::leave()
 {
-	m_current -= count;
+	// strings may still be referenced by an outer hook until it returns
+	if (--m_depth == 0)
+	{
+		m_current = 0;
+		m_used = 0;
+	}
 }
 
 CBaseEntity *GiveNamedItemInternal(AMX *amx, CBasePlayer *pPlayer, const char *pszItemName, const size_t uid)
@@ -47,6 +47,41 @@ inline const char *GetTeamName(TeamName team)
 	}
 }
 
+// Team of the player, UNASSIGNED without ReGameDLL
+inline TeamName GetPlayerTeam(edict_t *pEdict)
+{
+	CBasePlayer *pPlayer = api_cfg.hasReGameDLL() ? getPrivate<CBasePlayer>(pEdict) : nullptr;
+	return pPlayer ? pPlayer->m_iTeam : UNASSIGNED;
+}
+
+// Sends a sound to every active client separately through SV_EmitSound2, which still checks the PAS.
+// filter(cl, vecOrigin) returns the sample to send to the client, nullptr to skip it.
+// Returns the amount of clients the sound was sent to.
+template <typename F>
+int EmitSoundPerClient(edict_t *entity, int channel, int volume, float attenuation, int fFlags, int pitch, F filter)
+{
+	// the origin SV_StartSound uses
+	const Vector vecOrigin = entity->v.origin + (entity->v.mins + entity->v.maxs) * 0.5f;
+
+	int numSent = 0;
+	const int maxClients = min(gpGlobals->maxClients, MAX_CLIENTS);
+	for (int i = 0; i < maxClients; i++)
+	{
+		IGameClient *cl = g_RehldsSvs->GetClient(i);
+		if (!cl->IsActive() || (cl->GetEdict()->v.flags & FL_FAKECLIENT))
+			continue;
+
+		const char *sample = filter(cl, vecOrigin);
+		if (!sample)
+			continue;
+
+		if (g_RehldsFuncs->SV_EmitSound2(entity, cl, channel, sample, volume / 255.0f, attenuation, fFlags, pitch, 0, vecOrigin))
+			numSent++;
+	}
+
+	return numSent;
+}
+
 void Broadcast(const char *sentence);
 void UpdateTeamScores();
 ModelName GetModelAuto(TeamName team);
@@ -0,0 +1,138 @@
+#include "precompiled.h"
+
+CSoundCulling g_soundCulling;
+
+CSoundCulling::CSoundCulling()
+{
+	for (auto &distance : m_channels)
+		distance = 0.0f;
+}
+
+void CSoundCulling::SetChannelDistance(int channel, float distance)
+{
+	m_channels[channel] = max(distance, 0.0f);
+	UpdateHook();
+}
+
+void CSoundCulling::SetPrefixDistance(const char *prefix, float distance)
+{
+	for (auto it = m_prefixes.begin(); it != m_prefixes.end(); it++)
+	{
+		if (Q_stricmp(it->prefix, prefix) == 0)
+		{
+			m_prefixes.erase(it);
+			break;
+		}
+	}
+
+	if (distance > 0.0f)
+	{
+		prefix_t entry;
+		Q_strlcpy(entry.prefix, prefix);
+		entry.len = Q_strlen(entry.prefix);
+		entry.distance = distance;
+
+		auto it = m_prefixes.begin();
+		while (it != m_prefixes.end() && it->len >= entry.len)
+			it++;
+
+		m_prefixes.insert(it, entry);
+	}
+
+	UpdateHook();
+}
+
+void CSoundCulling::GetStats(uint32 &sent, uint32 &culled) const
+{
+	sent = m_sent;
+	culled = m_culled;
+}
+
+void CSoundCulling::Clear()
+{
+	for (auto &distance : m_channels)
+		distance = 0.0f;
+
+	m_prefixes.clear();
+	UpdateHook();
+}
+
+void CSoundCulling::UpdateHook()
+{
+	bool hook = !m_prefixes.empty();
+	for (auto distance : m_channels)
+	{
+		if (distance > 0.0f)
+			hook = true;
+	}
+
+	if (hook == m_hooked)
+		return;
+
+	// after the reapi hook, the forwards see every sound before it is culled
+	if (hook)
+		g_RehldsHookchains->SV_StartSound()->registerHook(&SV_StartSound, HC_PRIORITY_LOW);
+	else
+		g_RehldsHookchains->SV_StartSound()->unregisterHook(&SV_StartSound);
+
+	m_hooked = hook;
+}
+
+float CSoundCulling::GetDistance(int channel, const char *sample) const
+{
+	for (auto &entry : m_prefixes)
+	{
+		if (Q_strnicmp(sample, entry.prefix, entry.len) == 0)
+			return entry.distance;
+	}
+
+	if (channel >= 0 && channel < SOUND_CULL_CHANNELS)
+		return m_channels[channel];
+
+	return 0.0f;
+}
+
+void CSoundCulling::Emit(edict_t *entity, int channel, const char *sample, int volume, float attenuation, int fFlags, int pitch, float distance)
+{
+	int numInRange = 0;
+	const int numSent = EmitSoundPerClient(entity, channel, volume, attenuation, fFlags, pitch, [&](IGameClient *cl, const Vector &vecOrigin) -> const char * {
+		edict_t *pClient = cl->GetEdict();
+
+		// the proxies relay the sounds to their spectators
+		if (!(pClient->v.flags & FL_PROXY))
+		{
+			const Vector vecEars = pClient->v.origin + pClient->v.view_ofs;
+			if ((vecEars - vecOrigin).IsLengthGreaterThan(distance))
+			{
+				m_culled++;
+				return nullptr;
+			}
+		}
+
+		numInRange++;
+		return sample;
+	});
+
+	// the rest were out of the PAS
+	m_sent += numSent;
+	m_culled += numInRange - numSent;
+}
+
+void CSoundCulling::SV_StartSound(IRehldsHook_SV_StartSound *chain, int recipients, edict_t *entity, int channel, const char *sample, int volume, float attenuation, int fFlags, int pitch)
+{
+	// single recipient, static, stopped and unattenuated sounds go the usual way
+	if (recipients != 0 || channel == CHAN_STATIC || (fFlags & SND_STOP) || attenuation <= 0.0f || !sample)
+	{
+		chain->callNext(recipients, entity, channel, sample, volume, attenuation, fFlags, pitch);
+		return;
+	}
+
+	const float distance = g_soundCulling.GetDistance(channel, sample);
+	if (distance <= 0.0f)
+	{
+		chain->callNext(recipients, entity, channel, sample, volume, attenuation, fFlags, pitch);
+		return;
+	}
+
+	g_soundCulling.Emit(entity, channel, sample, volume, attenuation, fFlags, pitch, distance);
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#define SOUND_CULL_CHANNELS     8   // CHAN_AUTO .. CHAN_NETWORKVOICE_END
+#define SOUND_CULL_MAX_PREFIX   64
+
+// Opt-in culling of positional sounds by the distance to each recipient.
+// A culled sound is sent to every client separately through SV_EmitSound2, which still checks the PAS,
+// and is skipped for the clients farther than the audible distance of its channel or sample prefix.
+class CSoundCulling
+{
+public:
+	CSoundCulling();
+
+	// A distance of 0 removes the rule
+	void SetChannelDistance(int channel, float distance);
+	void SetPrefixDistance(const char *prefix, float distance);
+
+	// Counters of the sends to single recipients
+	void GetStats(uint32 &sent, uint32 &culled) const;
+	void ResetStats() { m_sent = m_culled = 0; }
+
+	// Removes all rules and unregisters the engine hook
+	void Clear();
+
+private:
+	static void SV_StartSound(IRehldsHook_SV_StartSound *chain, int recipients, edict_t *entity, int channel, const char *sample, int volume, float attenuation, int fFlags, int pitch);
+
+	// Audible distance of the sound, 0 if it isn't culled
+	float GetDistance(int channel, const char *sample) const;
+	void Emit(edict_t *entity, int channel, const char *sample, int volume, float attenuation, int fFlags, int pitch, float distance);
+	void UpdateHook();
+
+	struct prefix_t
+	{
+		char prefix[SOUND_CULL_MAX_PREFIX];
+		size_t len;
+		float distance;
+	};
+
+	bool m_hooked = false;
+	float m_channels[SOUND_CULL_CHANNELS];
+	std::vector<prefix_t> m_prefixes;   // longest prefix first
+
+	uint32 m_sent = 0;
+	uint32 m_culled = 0;
+};
+
+extern CSoundCulling g_soundCulling;
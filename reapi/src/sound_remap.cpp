@@ -0,0 +1,206 @@
+#include "precompiled.h"
+
+CSoundRemap g_soundRemap;
+
+CSoundRemap::CSoundRemap()
+{
+	for (auto &head : m_hash)
+		head = -1;
+}
+
+// case insensitive FNV-1a of the sample
+uint32 CSoundRemap::Hash(const char *sample)
+{
+	uint32 hash = 2166136261u;
+	while (*sample)
+	{
+		hash ^= (uint8)tolower(*sample++);
+		hash *= 16777619u;
+	}
+
+	return hash;
+}
+
+CSoundRemap::sample_t *CSoundRemap::Find(const char *sample)
+{
+	const uint32 hash = Hash(sample);
+
+	for (int index = m_hash[hash & (SOUND_REMAP_BUCKETS - 1)]; index != -1; index = m_samples[index].hnext)
+	{
+		sample_t &entry = m_samples[index];
+		if (entry.hash == hash && !Q_stricmp(entry.name, sample))
+			return &entry;
+	}
+
+	return nullptr;
+}
+
+void CSoundRemap::Set(const char *sample, const char *classname, int receiverTeam, const char *replacement)
+{
+	sample_t *entry = Find(sample);
+	if (!entry)
+	{
+		sample_t newEntry;
+		newEntry.hash = Hash(sample);
+		Q_strlcpy(newEntry.name, sample);
+
+		int &head = m_hash[newEntry.hash & (SOUND_REMAP_BUCKETS - 1)];
+		newEntry.hnext = head;
+		head = m_samples.size();
+
+		m_samples.push_back(newEntry);
+		entry = &m_samples.back();
+	}
+
+	for (auto &variant : entry->variants)
+	{
+		if (variant.team == receiverTeam && !Q_strcmp(variant.classname, classname))
+		{
+			Q_strlcpy(variant.replacement, replacement);
+			return;
+		}
+	}
+
+	variant_t variant;
+	Q_strlcpy(variant.classname, classname);
+	variant.team = receiverTeam;
+	Q_strlcpy(variant.replacement, replacement);
+
+	entry->variants.push_back(variant);
+	m_numVariants++;
+
+	UpdateHook();
+}
+
+bool CSoundRemap::Remove(const char *sample, const char *classname, int receiverTeam)
+{
+	sample_t *entry = Find(sample);
+	if (!entry)
+		return false;
+
+	// the sample stays in the hash, with no variants it's passed through
+	for (auto it = entry->variants.begin(); it != entry->variants.end(); it++)
+	{
+		if (it->team == receiverTeam && !Q_strcmp(it->classname, classname))
+		{
+			entry->variants.erase(it);
+			m_numVariants--;
+
+			UpdateHook();
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void CSoundRemap::Clear()
+{
+	m_samples.clear();
+	m_numVariants = 0;
+
+	for (auto &head : m_hash)
+		head = -1;
+
+	UpdateHook();
+}
+
+void CSoundRemap::UpdateHook()
+{
+	const bool hook = m_numVariants > 0;
+	if (hook == m_hooked)
+		return;
+
+	// ahead of the reapi hook, so that the forwards see the replaced sample and never see the blocked ones
+	if (hook)
+		g_RehldsHookchains->SV_StartSound()->registerHook(&SV_StartSound, HC_PRIORITY_HIGH);
+	else
+		g_RehldsHookchains->SV_StartSound()->unregisterHook(&SV_StartSound);
+
+	m_hooked = hook;
+}
+
+const CSoundRemap::variant_t *CSoundRemap::Resolve(const sample_t *entry, const char *classname, int team, bool *hasTeams)
+{
+	const variant_t *best = nullptr;
+	int bestScore = -1;
+
+	for (auto &variant : entry->variants)
+	{
+		int score = 0;
+		if (variant.classname[0] != '\0')
+		{
+			if (Q_strcmp(variant.classname, classname))
+				continue;
+
+			score += 2;
+		}
+
+		if (variant.team)
+		{
+			if (hasTeams)
+				*hasTeams = true;
+
+			if (variant.team != team)
+				continue;
+
+			score += 1;
+		}
+
+		if (score > bestScore)
+		{
+			best = &variant;
+			bestScore = score;
+		}
+	}
+
+	return best;
+}
+
+void CSoundRemap::Emit(const sample_t *entry, edict_t *entity, int channel, int volume, float attenuation, int fFlags, int pitch)
+{
+	const char *classname = STRING(entity->v.classname);
+
+	EmitSoundPerClient(entity, channel, volume, attenuation, fFlags, pitch, [&](IGameClient *cl, const Vector &) -> const char * {
+		const variant_t *variant = Resolve(entry, classname, GetPlayerTeam(cl->GetEdict()));
+		const char *sample = variant ? variant->replacement : entry->name;
+
+		// blocked for the team of this client
+		return (sample[0] != '\0') ? sample : nullptr;
+	});
+}
+
+void CSoundRemap::SV_StartSound(IRehldsHook_SV_StartSound *chain, int recipients, edict_t *entity, int channel, const char *sample, int volume, float attenuation, int fFlags, int pitch)
+{
+	const sample_t *entry = sample ? g_soundRemap.Find(sample) : nullptr;
+	if (!entry || entry->variants.empty())
+	{
+		chain->callNext(recipients, entity, channel, sample, volume, attenuation, fFlags, pitch);
+		return;
+	}
+
+	const char *classname = STRING(entity->v.classname);
+
+	// the only recipient of a single recipient sound is the entity itself
+	bool hasTeams = false;
+	const variant_t *variant = Resolve(entry, classname, (recipients != 0) ? GetPlayerTeam(entity) : -1, &hasTeams);
+
+	if (hasTeams && recipients == 0)
+	{
+		// the sample differs between the receivers, sent to every client separately
+		g_soundRemap.Emit(entry, entity, channel, volume, attenuation, fFlags, pitch);
+		return;
+	}
+
+	if (!variant)
+	{
+		chain->callNext(recipients, entity, channel, sample, volume, attenuation, fFlags, pitch);
+		return;
+	}
+
+	// blocked
+	if (variant->replacement[0] == '\0')
+		return;
+
+	chain->callNext(recipients, entity, channel, variant->replacement, volume, attenuation, fFlags, pitch);
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#define SOUND_REMAP_BUCKETS     512     // power of two
+
+// Replaces or blocks sounds by their sample, optionally only for an entity class or a receiver team.
+// Applied ahead of the RH_SV_StartSound forwards, so a footstep costs a hash lookup instead of a forward call.
+class CSoundRemap
+{
+public:
+	CSoundRemap();
+
+	// An empty replacement blocks the sound. An empty classname and team 0 match any.
+	void Set(const char *sample, const char *classname, int receiverTeam, const char *replacement);
+	bool Remove(const char *sample, const char *classname, int receiverTeam);
+
+	// Removes all variants and unregisters the engine hook
+	void Clear();
+
+private:
+	static void SV_StartSound(IRehldsHook_SV_StartSound *chain, int recipients, edict_t *entity, int channel, const char *sample, int volume, float attenuation, int fFlags, int pitch);
+
+	struct variant_t
+	{
+		char classname[32];
+		int team;
+		char replacement[MAX_QPATH];
+	};
+
+	struct sample_t
+	{
+		uint32 hash;
+		int hnext;
+		char name[MAX_QPATH];
+		std::vector<variant_t> variants;
+	};
+
+	static uint32 Hash(const char *sample);
+
+	sample_t *Find(const char *sample);
+
+	// Most specific variant for the entity class and the receiver team, nullptr if none matches.
+	// team is -1 to skip the team variants, hasTeams tells if any of them matches the class.
+	static const variant_t *Resolve(const sample_t *entry, const char *classname, int team, bool *hasTeams = nullptr);
+
+	void Emit(const sample_t *entry, edict_t *entity, int channel, int volume, float attenuation, int fFlags, int pitch);
+	void UpdateHook();
+
+	bool m_hooked = false;
+	size_t m_numVariants = 0;
+
+	std::vector<sample_t> m_samples;
+	int m_hash[SOUND_REMAP_BUCKETS];
+};
+
+extern CSoundRemap g_soundRemap;
@@ -0,0 +1,169 @@
+#include "precompiled.h"
+
+CStringCmdLimiter g_stringCmdLimiter;
+
+void CStringCmdLimiter::SetRate(float rate, float burst, StringCmdAction action, const char *kickMessage)
+{
+	m_rate = max(rate, 0.0f);
+	m_burst = max(burst, 1.0f);
+	m_action = action;
+	Q_strlcpy(m_kickMessage, kickMessage);
+
+	if (!IsEnabled())
+	{
+		Clear();
+		return;
+	}
+
+	if (!m_hooked)
+	{
+		// ahead of other hooks, so that plugins hooking the chain don't see limited commands either
+		g_RehldsHookchains->HandleNetCommand()->registerHook(&HandleNetCommand, HC_PRIORITY_HIGH);
+		m_hooked = true;
+	}
+}
+
+// case insensitive FNV-1a of the command name
+uint32 CStringCmdLimiter::Hash(const char *command, size_t len)
+{
+	uint32 hash = 2166136261u;
+	for (size_t i = 0; i < len; i++)
+	{
+		hash ^= (uint8)tolower(command[i]);
+		hash *= 16777619u;
+	}
+
+	return hash;
+}
+
+void CStringCmdLimiter::SetCost(const char *command, float cost)
+{
+	const size_t len = Q_strlen(command);
+	const uint32 hash = Hash(command, len);
+
+	for (auto &entry : m_costs)
+	{
+		if (entry.hash == hash && !Q_stricmp(entry.name, command))
+		{
+			entry.cost = max(cost, 0.0f);
+			return;
+		}
+	}
+
+	cmdcost_t entry;
+	entry.hash = hash;
+	entry.cost = max(cost, 0.0f);
+	Q_strlcpy(entry.name, command);
+	m_costs.push_back(entry);
+}
+
+float CStringCmdLimiter::GetCost(const char *command, size_t len) const
+{
+	if (m_costs.empty())
+		return 1.0f;
+
+	const uint32 hash = Hash(command, len);
+	for (auto &entry : m_costs)
+	{
+		if (entry.hash == hash && !Q_strnicmp(entry.name, command, len) && entry.name[len] == '\0')
+			return entry.cost;
+	}
+
+	return 1.0f;
+}
+
+bool CStringCmdLimiter::Accept(IGameClient *cl, const char *command, size_t size)
+{
+	// the command name is the first token of the line,
+	// the string isn't terminated if the message is truncated
+	const char *end = command + size;
+	while (command < end && *command && *command <= ' ')
+		command++;
+
+	size_t len = 0;
+	while (command + len < end && command[len] > ' ' && command[len] != ';')
+		len++;
+
+	const float cost = GetCost(command, len);
+
+	bucket_t &bucket = m_buckets[cl->GetId()];
+	const double now = g_RehldsFuncs->GetRealTime();
+	const int userid = clientOfIndex(cl->GetId() + 1)->userid;
+
+	if (bucket.userid != userid)
+	{
+		bucket.userid = userid;
+		bucket.tokens = m_burst;
+		bucket.updated = now;
+		bucket.accepted = 0;
+		bucket.dropped = 0;
+	}
+	else if (now > bucket.updated)
+	{
+		bucket.tokens = min(m_burst, bucket.tokens + float((now - bucket.updated) * m_rate));
+		bucket.updated = now;
+	}
+
+	if (bucket.tokens < cost)
+	{
+		bucket.dropped++;
+		m_dropped++;
+		return false;
+	}
+
+	bucket.tokens -= cost;
+	bucket.accepted++;
+	m_accepted++;
+	return true;
+}
+
+void CStringCmdLimiter::GetStats(int index, uint32 &accepted, uint32 &dropped) const
+{
+	if (index <= 0)
+	{
+		accepted = m_accepted;
+		dropped = m_dropped;
+		return;
+	}
+
+	const bucket_t &bucket = m_buckets[index - 1];
+	accepted = bucket.accepted;
+	dropped = bucket.dropped;
+}
+
+void CStringCmdLimiter::Clear()
+{
+	if (m_hooked)
+	{
+		g_RehldsHookchains->HandleNetCommand()->unregisterHook(&HandleNetCommand);
+		m_hooked = false;
+	}
+
+	m_rate = 0.0f;
+	Q_memset(m_buckets, 0, sizeof(m_buckets));
+	m_accepted = 0;
+	m_dropped = 0;
+}
+
+void CStringCmdLimiter::HandleNetCommand(IRehldsHook_HandleNetCommand *chain, IGameClient *cl, uint8 opcode)
+{
+	if (opcode == CLC_STRINGCMD && g_stringCmdLimiter.IsEnabled())
+	{
+		// the command is still unread, peek at it in the message
+		sizebuf_t *msg = g_RehldsFuncs->GetNetMessage();
+		const int readcount = *g_RehldsFuncs->GetMsgReadCount();
+
+		if (readcount < msg->cursize && !g_stringCmdLimiter.Accept(cl, (const char *)&msg->data[readcount], msg->cursize - readcount))
+		{
+			// consume it to keep the rest of the message in sync
+			g_RehldsFuncs->MSG_ReadString();
+
+			if (g_stringCmdLimiter.m_action == STRINGCMD_KICK)
+				g_RehldsFuncs->DropClient(cl, false, g_stringCmdLimiter.m_kickMessage);
+
+			return;
+		}
+	}
+
+	chain->callNext(cl, opcode);
+}
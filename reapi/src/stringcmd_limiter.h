@@ -0,0 +1,68 @@
+#pragma once
+
+#define CLC_STRINGCMD   3       // clc_stringcmd
+
+// action on a command over the limit
+enum StringCmdAction
+{
+	STRINGCMD_DROP = 0,         // the command is silently dropped
+	STRINGCMD_KICK,             // the command is dropped and the client is kicked
+};
+
+// Token bucket per client for string commands, checked when the engine starts parsing a clc_stringcmd,
+// before the engine, the game dll or any plugin forward sees the command.
+class CStringCmdLimiter
+{
+public:
+	// A rate of 0 disables the limiter
+	void SetRate(float rate, float burst, StringCmdAction action, const char *kickMessage);
+	bool IsEnabled() const { return m_rate > 0.0f; }
+
+	// Tokens taken by the command, 1.0 unless set. A cost of 0 makes the command unlimited.
+	void SetCost(const char *command, float cost);
+	float GetCost(const char *command, size_t len) const;
+
+	// Counters of the client, or totals of all the clients if index is 0
+	void GetStats(int index, uint32 &accepted, uint32 &dropped) const;
+
+	// Unregisters the engine hook
+	void Clear();
+
+private:
+	static void HandleNetCommand(IRehldsHook_HandleNetCommand *chain, IGameClient *cl, uint8 opcode);
+
+	// Returns false if the command must be dropped
+	bool Accept(IGameClient *cl, const char *command, size_t size);
+
+	struct bucket_t
+	{
+		int userid;         // the bucket is reset when another client takes the slot
+		float tokens;
+		double updated;
+		uint32 accepted;
+		uint32 dropped;
+	};
+
+	struct cmdcost_t
+	{
+		uint32 hash;
+		char name[32];
+		float cost;
+	};
+
+	static uint32 Hash(const char *command, size_t len);
+
+	bool m_hooked = false;
+	float m_rate = 0.0f;
+	float m_burst = 0.0f;
+	StringCmdAction m_action = STRINGCMD_DROP;
+	char m_kickMessage[128];
+
+	bucket_t m_buckets[MAX_CLIENTS];
+	std::vector<cmdcost_t> m_costs;
+
+	uint32 m_accepted = 0;
+	uint32 m_dropped = 0;
+};
+
+extern CStringCmdLimiter g_stringCmdLimiter;
@@ -0,0 +1,117 @@
+#include "precompiled.h"
+
+CStudioCache g_studioCache;
+
+CStudioModelInfo::CStudioModelInfo(const studiohdr_t *pstudiohdr) : m_pstudiohdr(pstudiohdr)
+{
+	for (int type = 0; type < SNT_MAX; type++)
+	{
+		int count = GetCount(StudioNameType(type));
+
+		size_t size = 8;
+		while (size < size_t(count) * 2)
+			size <<= 1;
+
+		auto &table = m_table[type];
+		table.assign(size, -1);
+
+		for (int i = 0; i < count; i++)
+		{
+			const char *name = GetName(StudioNameType(type), i);
+			if (!name[0])
+				continue;
+
+			// the first one wins, same as a linear search
+			size_t slot = Hash(name) & (size - 1);
+			while (table[slot] != -1 && Q_stricmp(GetName(StudioNameType(type), table[slot]), name) != 0)
+				slot = (slot + 1) & (size - 1);
+
+			if (table[slot] == -1)
+				table[slot] = int16(i);
+		}
+	}
+}
+
+int CStudioModelInfo::Lookup(StudioNameType type, const char *name) const
+{
+	const auto &table = m_table[type];
+	const size_t mask = table.size() - 1;
+
+	for (size_t slot = Hash(name) & mask; table[slot] != -1; slot = (slot + 1) & mask)
+	{
+		if (!Q_stricmp(GetName(type, table[slot]), name))
+			return table[slot];
+	}
+
+	return -1;
+}
+
+int CStudioModelInfo::GetCount(StudioNameType type) const
+{
+	switch (type)
+	{
+	case SNT_SEQUENCE:   return m_pstudiohdr->numseq;
+	case SNT_BONE:       return m_pstudiohdr->numbones;
+	case SNT_ATTACHMENT: return m_pstudiohdr->numattachments;
+	case SNT_BODYGROUP:  return m_pstudiohdr->numbodyparts;
+	default:             return 0;
+	}
+}
+
+const char *CStudioModelInfo::GetName(StudioNameType type, int index) const
+{
+	const byte *pbase = (const byte *)m_pstudiohdr;
+
+	switch (type)
+	{
+	case SNT_SEQUENCE:   return ((const mstudioseqdesc_t *)(pbase + m_pstudiohdr->seqindex))[index].label;
+	case SNT_BONE:       return ((const mstudiobone_t *)(pbase + m_pstudiohdr->boneindex))[index].name;
+	case SNT_ATTACHMENT: return ((const mstudioattachment_t *)(pbase + m_pstudiohdr->attachmentindex))[index].name;
+	case SNT_BODYGROUP:  return ((const mstudiobodyparts_t *)(pbase + m_pstudiohdr->bodypartindex))[index].name;
+	default:             return "";
+	}
+}
+
+// FNV-1a of the lowercased name
+uint32 CStudioModelInfo::Hash(const char *name)
+{
+	uint32 hash = 2166136261u;
+	while (*name)
+	{
+		hash ^= (byte)tolower(*name++);
+		hash *= 16777619u;
+	}
+
+	return hash;
+}
+
+const CStudioModelInfo *CStudioCache::Get(edict_t *pEdict)
+{
+	int modelindex = pEdict->v.modelindex;
+	if (modelindex <= 0 || modelindex >= MAX_MODELS)
+		return nullptr;
+
+	studiohdr_t *pstudiohdr = static_cast<studiohdr_t *>(GET_MODEL_PTR(pEdict));
+	if (!pstudiohdr)
+		return nullptr;
+
+	if (size_t(modelindex) >= m_models.size())
+		m_models.resize(modelindex + 1, nullptr);
+
+	CStudioModelInfo *pInfo = m_models[modelindex];
+	if (likely(pInfo && pInfo->GetHeader() == pstudiohdr))
+		return pInfo;
+
+	// first use or the engine cache has moved the model data
+	delete pInfo;
+	pInfo = m_models[modelindex] = new CStudioModelInfo(pstudiohdr);
+	return pInfo;
+}
+
+void CStudioCache::Clear()
+{
+	for (auto pInfo : m_models)
+		delete pInfo;
+
+	m_models.clear();
+}
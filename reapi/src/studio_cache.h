@@ -0,0 +1,51 @@
+#pragma once
+
+enum StudioNameType
+{
+	SNT_SEQUENCE,
+	SNT_BONE,
+	SNT_ATTACHMENT,
+	SNT_BODYGROUP,
+
+	SNT_MAX
+};
+
+// Name to index lookup tables of a studio model.
+// Names are not copied, the tables point to the model data.
+class CStudioModelInfo
+{
+public:
+	CStudioModelInfo(const studiohdr_t *pstudiohdr);
+
+	const studiohdr_t *GetHeader() const { return m_pstudiohdr; }
+
+	// Returns the index of the named item or -1, names are case insensitive
+	int Lookup(StudioNameType type, const char *name) const;
+
+private:
+	int GetCount(StudioNameType type) const;
+	const char *GetName(StudioNameType type, int index) const;
+
+	static uint32 Hash(const char *name);
+
+	const studiohdr_t *m_pstudiohdr;
+
+	// open addressing tables, -1 is an empty slot
+	std::vector<int16> m_table[SNT_MAX];
+};
+
+// Model infos by model index, built on first use and dropped on map change
+class CStudioCache
+{
+public:
+	~CStudioCache() { Clear(); }
+
+	// Returns the info of the entity's current model, nullptr if it isn't a studio model
+	const CStudioModelInfo *Get(edict_t *pEdict);
+	void Clear();
+
+private:
+	std::vector<CStudioModelInfo *> m_models;
+};
+
+extern CStudioCache g_studioCache;
@@ -0,0 +1,296 @@
+#include "precompiled.h"
+
+CTimerWheel g_timerWheel;
+
+CTimerWheel::CTimerWheel()
+{
+	for (auto &head : m_lists)
+		head = -1;
+}
+
+int CTimerWheel::GetCallback(AMX *amx, const char *funcname, bool hasParams)
+{
+	for (size_t i = 0; i < m_callbacks.size(); i++)
+	{
+		const callback_t &callback = m_callbacks[i];
+		if (callback.hook->GetAmx() == amx && callback.hasParams == hasParams && !Q_strcmp(callback.hook->GetCallbackName(), funcname))
+			return i;
+	}
+
+	int fwdid;
+	if (hasParams)
+		fwdid = g_amxxapi.RegisterSPForwardByName(amx, funcname, FP_CELL, FP_CELL, FP_ARRAY, FP_DONE);
+	else
+		fwdid = g_amxxapi.RegisterSPForwardByName(amx, funcname, FP_CELL, FP_CELL, FP_DONE);
+
+	if (fwdid == -1)
+		return -1;
+
+	m_callbacks.push_back({ new CAmxxHookBase(amx, funcname, fwdid, -1), hasParams });
+	return m_callbacks.size() - 1;
+}
+
+int CTimerWheel::Schedule(AMX *amx, const char *funcname, float flDelay, bool repeat, int entity, const cell *pParams, size_t iParamsLen)
+{
+	int callback = GetCallback(amx, funcname, iParamsLen > 0);
+	if (callback == -1)
+		return 0;
+
+	if (!m_started)
+	{
+		m_current = TimeToTick(gpGlobals->time);
+		m_started = true;
+	}
+
+	int index;
+	if (!m_free.empty())
+	{
+		index = m_free.back();
+		m_free.pop_back();
+	}
+	else
+	{
+		if (m_timers.size() >= (1u << TIMER_INDEX_BITS) - 1)
+			return 0;
+
+		index = m_timers.size();
+		m_timers.push_back({});
+		m_timers[index].serial = 0;
+	}
+
+	wheeltimer_t &timer = m_timers[index];
+
+	flDelay = max(flDelay, 0.0f);
+
+	timer.expires  = max(m_current + 1, uint32(ceil((gpGlobals->time + flDelay) / TIMER_TICK)));
+	timer.interval = repeat ? max(1u, uint32(flDelay / TIMER_TICK + 0.5f)) : 0;
+	timer.callback = callback;
+	timer.entity   = entity;
+	timer.eprev    = -1;
+	timer.enext    = -1;
+
+	timer.userParams.Set(pParams, iParamsLen);
+
+	if (entity > 0)
+	{
+		if (size_t(entity) >= m_entityTimers.size())
+			m_entityTimers.resize(max(entity + 1, gpGlobals->maxEntities + 1), -1);
+
+		timer.enext = m_entityTimers[entity];
+		if (timer.enext != -1)
+			m_timers[timer.enext].eprev = index;
+
+		m_entityTimers[entity] = index;
+	}
+
+	Link(index);
+	return GetHandle(index);
+}
+
+int CTimerWheel::GetTimerIndex(int handle) const
+{
+	int index = (handle & ((1 << TIMER_INDEX_BITS) - 1)) - 1;
+	if (index < 0 || size_t(index) >= m_timers.size())
+		return -1;
+
+	const wheeltimer_t &timer = m_timers[index];
+	if (timer.list == TIMER_FREE || GetHandle(index) != handle)
+		return -1;
+
+	return index;
+}
+
+bool CTimerWheel::Cancel(int handle)
+{
+	int index = GetTimerIndex(handle);
+	if (index == -1)
+		return false;
+
+	Release(index);
+	return true;
+}
+
+bool CTimerWheel::IsActive(int handle) const
+{
+	return GetTimerIndex(handle) != -1;
+}
+
+float CTimerWheel::GetTimeLeft(int handle) const
+{
+	int index = GetTimerIndex(handle);
+	if (index == -1)
+		return -1.0f;
+
+	return max(m_timers[index].expires * TIMER_TICK - gpGlobals->time, 0.0f);
+}
+
+void CTimerWheel::Link(int index)
+{
+	wheeltimer_t &timer = m_timers[index];
+
+	// pick the level by the distance to the expiry, the slot by the expiry itself
+	uint32 delta = timer.expires - m_current;
+	int level = 0;
+
+	while (level < TIMER_WHEEL_LEVELS - 1 && delta >= (1u << ((level + 1) * TIMER_WHEEL_BITS)))
+		level++;
+
+	const uint32 maxDelta = (1u << (TIMER_WHEEL_LEVELS * TIMER_WHEEL_BITS)) - 1;
+	if (delta > maxDelta)
+		timer.expires = m_current + maxDelta;
+
+	int list = level * TIMER_WHEEL_SIZE + ((timer.expires >> (level * TIMER_WHEEL_BITS)) & (TIMER_WHEEL_SIZE - 1));
+
+	timer.list = list;
+	timer.prev = -1;
+	timer.next = m_lists[list];
+
+	if (timer.next != -1)
+		m_timers[timer.next].prev = index;
+
+	m_lists[list] = index;
+}
+
+void CTimerWheel::Unlink(int index)
+{
+	wheeltimer_t &timer = m_timers[index];
+	if (timer.list < 0)
+		return;
+
+	if (timer.prev != -1)
+		m_timers[timer.prev].next = timer.next;
+	else
+		m_lists[timer.list] = timer.next;
+
+	if (timer.next != -1)
+		m_timers[timer.next].prev = timer.prev;
+
+	timer.list = TIMER_FIRING;
+	timer.prev = timer.next = -1;
+}
+
+void CTimerWheel::Release(int index)
+{
+	Unlink(index);
+
+	wheeltimer_t &timer = m_timers[index];
+
+	if (timer.entity > 0)
+	{
+		if (timer.eprev != -1)
+			m_timers[timer.eprev].enext = timer.enext;
+		else
+			m_entityTimers[timer.entity] = timer.enext;
+
+		if (timer.enext != -1)
+			m_timers[timer.enext].eprev = timer.eprev;
+
+		timer.entity = 0;
+	}
+
+	timer.userParams.Clear();
+
+	timer.list = TIMER_FREE;
+	timer.serial++;
+
+	m_free.push_back(index);
+}
+
+void CTimerWheel::Cascade(int level)
+{
+	int list = level * TIMER_WHEEL_SIZE + ((m_current >> (level * TIMER_WHEEL_BITS)) & (TIMER_WHEEL_SIZE - 1));
+
+	int index = m_lists[list];
+	m_lists[list] = -1;
+
+	while (index != -1)
+	{
+		int next = m_timers[index].next;
+		Link(index);
+		index = next;
+	}
+}
+
+void CTimerWheel::Advance()
+{
+	if (!m_started)
+		return;
+
+	const uint32 target = TimeToTick(gpGlobals->time);
+
+	while (int32(target - m_current) > 0)
+	{
+		m_current++;
+
+		// the lower level has wrapped, bring the next slot of the upper level down
+		for (int level = 1; level < TIMER_WHEEL_LEVELS; level++)
+		{
+			if (m_current & ((1u << (level * TIMER_WHEEL_BITS)) - 1))
+				break;
+
+			Cascade(level);
+		}
+
+		// move the slot aside, callbacks may schedule and cancel timers
+		int list = m_current & (TIMER_WHEEL_SIZE - 1);
+
+		m_lists[TIMER_EXPIRING] = m_lists[list];
+		m_lists[list] = -1;
+
+		for (int index = m_lists[TIMER_EXPIRING]; index != -1; index = m_timers[index].next)
+			m_timers[index].list = TIMER_EXPIRING;
+
+		while (m_lists[TIMER_EXPIRING] != -1)
+		{
+			int index = m_lists[TIMER_EXPIRING];
+			Unlink(index);
+
+			// don't keep references, the callback may grow the pool
+			wheeltimer_t &timer = m_timers[index];
+			const int handle = GetHandle(index);
+			const int entity = timer.entity;
+			const CAmxxHookBase *hook = m_callbacks[timer.callback].hook;
+
+			if (timer.interval)
+			{
+				timer.expires = m_current + timer.interval;
+				Link(index);
+			}
+
+			if (!timer.userParams.IsEmpty())
+				g_amxxapi.ExecuteForward(hook->GetFwdIndex(), handle, entity, g_amxxapi.PrepareCellArrayA(timer.userParams.GetData(), timer.userParams.GetSize(), false));
+			else
+				g_amxxapi.ExecuteForward(hook->GetFwdIndex(), handle, entity);
+
+			// one-shot timer that wasn't cancelled by its own callback
+			if (GetTimerIndex(handle) == index && m_timers[index].list == TIMER_FIRING)
+				Release(index);
+		}
+	}
+}
+
+void CTimerWheel::OnEntityFreed(int entity)
+{
+	if (size_t(entity) >= m_entityTimers.size())
+		return;
+
+	while (m_entityTimers[entity] != -1)
+		Release(m_entityTimers[entity]);
+}
+
+void CTimerWheel::Clear()
+{
+	for (auto &callback : m_callbacks)
+		delete callback.hook;
+
+	m_timers.clear();
+	m_free.clear();
+	m_entityTimers.clear();
+	m_callbacks.clear();
+
+	for (auto &head : m_lists)
+		head = -1;
+
+	m_started = false;
+	m_current = 0;
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "amx_hook.h"
+
+#define TIMER_TICK          0.01f   // resolution of the wheel in seconds
+#define TIMER_WHEEL_BITS    6
+#define TIMER_WHEEL_SIZE    (1 << TIMER_WHEEL_BITS)
+#define TIMER_WHEEL_LEVELS  4       // 64 ticks, 40 seconds, 43 minutes, 46 hours
+
+#define TIMER_INDEX_BITS    20
+#define TIMER_SERIAL_MASK   0x7FF
+
+// Hierarchical timer wheel advanced every server frame.
+// Scheduling and cancelling are O(1), each timer is cascaded at most once per level.
+class CTimerWheel
+{
+public:
+	CTimerWheel();
+	~CTimerWheel() { Clear(); }
+
+	// Returns the timer handle or 0 if the callback can't be found
+	int Schedule(AMX *amx, const char *funcname, float flDelay, bool repeat, int entity, const cell *pParams, size_t iParamsLen);
+	bool Cancel(int handle);
+	bool IsActive(int handle) const;
+
+	// Seconds left until the timer fires, -1.0 if it isn't active
+	float GetTimeLeft(int handle) const;
+
+	// Fires the timers due up to the current server time
+	void Advance();
+
+	// Cancels the timers bound to the entity
+	void OnEntityFreed(int entity);
+
+	void Clear();
+
+private:
+	enum
+	{
+		TIMER_FREE = -2,
+		TIMER_FIRING = -1,  // one-shot timer whose callback is running
+		TIMER_EXPIRING = TIMER_WHEEL_LEVELS * TIMER_WHEEL_SIZE,
+		TIMER_NUM_LISTS
+	};
+
+	struct wheeltimer_t
+	{
+		int prev, next;         // links in the slot list
+		int eprev, enext;       // links in the bound entity list
+		int list;               // list the timer is linked to, TIMER_FIRING or TIMER_FREE
+		uint32 expires;         // absolute tick
+		uint32 interval;        // ticks, 0 if the timer doesn't repeat
+		uint32 serial;
+		int entity;
+		int callback;           // index of the shared forward
+
+		// User-provided data to be passed to their callback function
+		CAmxxUserParams userParams;
+	};
+
+	int GetTimerIndex(int handle) const;
+	int GetHandle(int index) const { return ((m_timers[index].serial & TIMER_SERIAL_MASK) << TIMER_INDEX_BITS) | (index + 1); }
+	int GetCallback(AMX *amx, const char *funcname, bool hasParams);
+
+	void Link(int index);
+	void Unlink(int index);
+	void Release(int index);
+	void Cascade(int level);
+
+	static uint32 TimeToTick(float time) { return uint32(time / TIMER_TICK); }
+
+	bool m_started = false;
+	uint32 m_current = 0;
+
+	std::vector<wheeltimer_t> m_timers;
+	std::vector<int> m_free;
+	int m_lists[TIMER_NUM_LISTS];
+
+	// first bound timer of each entity
+	std::vector<int> m_entityTimers;
+
+	// the forwards are shared between the timers with the same callback
+	struct callback_t
+	{
+		CAmxxHookBase *hook;
+		bool hasParams;
+	};
+
+	std::vector<callback_t> m_callbacks;
+};
+
+extern CTimerWheel g_timerWheel;
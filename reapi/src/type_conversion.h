@@ -155,21 +155,32 @@ inline T get_member_direct(edict_t *pEntity, int offset, int element = 0, int si
 	return get_member_direct<T>(pEntity->pvPrivateData, offset, element, size);
 }
 
+// Bump allocator for the strings passed to hooked functions through SetHookChainArg.
+// Grows in chunks on demand, memory is reused once the outermost dispatch returns.
 class CTempStrings
 {
 public:
 	CTempStrings();
-	char* push(struct tagAMX* amx);
-	void pop(size_t count);
+	~CTempStrings();
+
+	char* alloc(size_t size);
+	void enter();
+	void leave();
 
 	enum
 	{
-		STRINGS_MAX = 16,
-		STRING_SIZE = 1024,
-		STRING_LEN = STRING_SIZE - 1
+		CHUNK_SIZE = 4096
 	};
 
 private:
-	size_t m_current;
-	char m_strings[STRINGS_MAX][STRING_SIZE];
+	struct chunk_t
+	{
+		char *data;
+		size_t size;
+	};
+
+	std::vector<chunk_t> m_chunks;
+	size_t m_current; // chunk in use
+	size_t m_used;    // bytes used in current chunk
+	size_t m_depth;   // nesting level of dispatches
 };
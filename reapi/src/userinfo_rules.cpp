@@ -0,0 +1,111 @@
+#include "precompiled.h"
+
+CUserInfoRules g_userInfoRules;
+
+int CUserInfoRules::AddRule(int client, int team, int receiverTeam, UserInfoRuleAction action, const char *key, const char *value)
+{
+	// drop the rules of the clients that have left since
+	m_rules.erase(std::remove_if(m_rules.begin(), m_rules.end(), [](const rule_t &rule) {
+		return rule.client && rule.userid != clientOfIndex(rule.client)->userid;
+	}), m_rules.end());
+
+	rule_t rule;
+	rule.id = ++m_lastId;
+	rule.client = client;
+	rule.userid = client ? clientOfIndex(client)->userid : 0;
+	rule.team = team;
+	rule.receiverTeam = receiverTeam;
+	rule.action = action;
+	Q_strlcpy(rule.key, key);
+	Q_strlcpy(rule.value, value);
+
+	m_rules.push_back(rule);
+
+	if (!m_hooked)
+	{
+		// ahead of the reapi hook, so that the forwards see the rewritten userinfo
+		g_RehldsHookchains->SV_WriteFullClientUpdate()->registerHook(&SV_WriteFullClientUpdate, HC_PRIORITY_HIGH);
+		m_hooked = true;
+	}
+
+	return rule.id;
+}
+
+bool CUserInfoRules::RemoveRule(int id)
+{
+	for (auto it = m_rules.begin(); it != m_rules.end(); it++)
+	{
+		if (it->id != id)
+			continue;
+
+		m_rules.erase(it);
+
+		if (m_rules.empty())
+			Clear();
+
+		return true;
+	}
+
+	return false;
+}
+
+void CUserInfoRules::Clear()
+{
+	if (m_hooked)
+	{
+		g_RehldsHookchains->SV_WriteFullClientUpdate()->unregisterHook(&SV_WriteFullClientUpdate);
+		m_hooked = false;
+	}
+
+	m_rules.clear();
+}
+
+void CUserInfoRules::Apply(IGameClient *client, char *buffer, size_t maxlen, IGameClient *receiver) const
+{
+	const int index = client->GetId() + 1;
+	int team = -1, receiverTeam = -1;
+
+	for (auto &rule : m_rules)
+	{
+		if (rule.client && rule.client != index)
+			continue;
+
+		// the slot has been taken by another client
+		if (rule.client && rule.userid != clientOfIndex(index)->userid)
+			continue;
+
+		if (rule.team)
+		{
+			if (team == -1)
+				team = GetPlayerTeam(client->GetEdict());
+
+			if (rule.team != team)
+				continue;
+		}
+
+		if (rule.receiverTeam)
+		{
+			// broadcast updates have no receiver, the same data goes to everyone
+			if (!receiver)
+				continue;
+
+			if (receiverTeam == -1)
+				receiverTeam = GetPlayerTeam(receiver->GetEdict());
+
+			if (rule.receiverTeam != receiverTeam)
+				continue;
+		}
+
+		if (rule.action == USERINFO_RULE_REMOVE)
+			Info_RemoveKey(buffer, rule.key);
+		else
+			Info_SetValueForStarKey(buffer, rule.key, rule.value, maxlen);
+	}
+}
+
+void CUserInfoRules::SV_WriteFullClientUpdate(IRehldsHook_SV_WriteFullClientUpdate *chain, IGameClient *client, char *buffer, size_t maxlen, sizebuf_t *sb, IGameClient *receiver)
+{
+	// the buffer is a copy of the userinfo made for this update
+	g_userInfoRules.Apply(client, buffer, maxlen, receiver);
+	chain->callNext(client, buffer, maxlen, sb, receiver);
+}
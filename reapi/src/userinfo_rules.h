@@ -0,0 +1,46 @@
+#pragma once
+
+// rule actions
+enum UserInfoRuleAction
+{
+	USERINFO_RULE_SET = 0,      // the key is set to the value
+	USERINFO_RULE_REMOVE,       // the key is removed
+};
+
+// Rewrites the userinfo sent in scoreboard updates (SV_WriteFullClientUpdate) by a table of rules,
+// so that hiding models or renaming players per receiver team doesn't cost an AMX call per client pair.
+// The rules are applied ahead of the RH_SV_WriteFullClientUpdate forwards, which see the rewritten buffer.
+class CUserInfoRules
+{
+public:
+	// client and teams are 0 to match any, returns the rule id
+	// team rules are matched only with ReGameDLL
+	int AddRule(int client, int team, int receiverTeam, UserInfoRuleAction action, const char *key, const char *value);
+	bool RemoveRule(int id);
+
+	// Removes all rules and unregisters the engine hook
+	void Clear();
+
+private:
+	static void SV_WriteFullClientUpdate(IRehldsHook_SV_WriteFullClientUpdate *chain, IGameClient *client, char *buffer, size_t maxlen, sizebuf_t *sb, IGameClient *receiver);
+
+	void Apply(IGameClient *client, char *buffer, size_t maxlen, IGameClient *receiver) const;
+
+	struct rule_t
+	{
+		int id;
+		int client;
+		int userid;         // of the client when the rule was added
+		int team;
+		int receiverTeam;
+		UserInfoRuleAction action;
+		char key[MAX_KV_LEN];
+		char value[MAX_KV_LEN];
+	};
+
+	std::vector<rule_t> m_rules;
+	int m_lastId = 0;
+	bool m_hooked = false;
+};
+
+extern CUserInfoRules g_userInfoRules;
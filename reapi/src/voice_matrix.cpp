@@ -0,0 +1,171 @@
+#include "precompiled.h"
+
+CVoiceMatrix g_voiceMatrix;
+
+CVoiceMatrix::CVoiceMatrix()
+{
+	memset(m_hear, 0, sizeof(m_hear));
+	memset(m_decided, 0, sizeof(m_decided));
+	memset(m_userid, 0, sizeof(m_userid));
+}
+
+void CVoiceMatrix::Validate(int index)
+{
+	const int userid = GETPLAYERUSERID(edictByIndex(index));
+	if (m_userid[index] == userid)
+		return;
+
+	m_userid[index] = userid;
+
+	// the routes of the previous client of the slot, as a listener and as a sender
+	const uint32 bit = 1 << (index & 31);
+	m_hear[index] = m_decided[index] = 0;
+
+	for (int i = 1; i <= MAX_CLIENTS; i++)
+	{
+		m_hear[i] &= ~bit;
+		m_decided[i] &= ~bit;
+	}
+}
+
+void CVoiceMatrix::Set(int listener, int sender, VoiceRoute route)
+{
+	const int maxClients = min(gpGlobals->maxClients, MAX_CLIENTS);
+	const uint32 senderBits = sender ? 1 << (sender & 31) : 0xFFFFFFFF;
+
+	if (sender)
+		Validate(sender);
+
+	for (int i = (listener ? listener : 1); i <= (listener ? listener : maxClients); i++)
+	{
+		Validate(i);
+
+		if (route == VOICE_ROUTE_DEFAULT)
+			m_decided[i] &= ~senderBits;
+		else
+			m_decided[i] |= senderBits;
+
+		if (route == VOICE_ROUTE_HEAR)
+			m_hear[i] |= senderBits;
+		else
+			m_hear[i] &= ~senderBits;
+	}
+
+	UpdateHook();
+}
+
+VoiceRoute CVoiceMatrix::Get(int listener, int sender)
+{
+	Validate(listener);
+	Validate(sender);
+
+	const uint32 bit = 1 << (sender & 31);
+	if (!(m_decided[listener] & bit))
+		return VOICE_ROUTE_DEFAULT;
+
+	return (m_hear[listener] & bit) ? VOICE_ROUTE_HEAR : VOICE_ROUTE_MUTE;
+}
+
+void CVoiceMatrix::SetRow(int listener, uint32 hearBits, uint32 decidedBits)
+{
+	Validate(listener);
+
+	m_hear[listener] = (m_hear[listener] & ~decidedBits) | (hearBits & decidedBits);
+	m_decided[listener] |= decidedBits;
+
+	UpdateHook();
+}
+
+void CVoiceMatrix::ApplyRules(int rules)
+{
+	g_playerSnapshot.Update();
+
+	const int connected = g_playerSnapshot.GetConnectedBits();
+	const int alive = g_playerSnapshot.GetAliveBits();
+
+	const int maxClients = min(gpGlobals->maxClients, MAX_CLIENTS);
+	for (int i = 1; i <= maxClients; i++)
+	{
+		const uint32 bit = 1 << (i & 31);
+		if (!(connected & bit))
+			continue;
+
+		Validate(i);
+
+		uint32 hear = connected;
+
+		if (rules & VOICE_RULE_TEAM)
+		{
+			for (int team = UNASSIGNED; team <= SPECTATOR; team++)
+			{
+				const uint32 teamBits = g_playerSnapshot.GetTeamBits((TeamName)team);
+				if (teamBits & bit)
+				{
+					hear &= teamBits;
+					break;
+				}
+			}
+		}
+
+		if ((rules & VOICE_RULE_DEAD) && (alive & bit))
+			hear &= alive;
+
+		// the players connecting later stay with the forwards until the rules are applied again
+		m_hear[i] = (m_hear[i] & ~connected) | hear;
+		m_decided[i] |= connected;
+	}
+
+	UpdateHook();
+}
+
+void CVoiceMatrix::Clear()
+{
+	memset(m_hear, 0, sizeof(m_hear));
+	memset(m_decided, 0, sizeof(m_decided));
+
+	UpdateHook();
+}
+
+void CVoiceMatrix::UpdateHook()
+{
+	bool hook = false;
+	for (auto decided : m_decided)
+	{
+		if (decided)
+		{
+			hook = true;
+			break;
+		}
+	}
+
+	if (hook == m_hooked)
+		return;
+
+	// ahead of the reapi hook, the decided pairs never reach the forwards
+	if (hook)
+		g_ReGameHookchains->CSGameRules_CanPlayerHearPlayer()->registerHook(&CSGameRules_CanPlayerHearPlayer, HC_PRIORITY_HIGH);
+	else
+		g_ReGameHookchains->CSGameRules_CanPlayerHearPlayer()->unregisterHook(&CSGameRules_CanPlayerHearPlayer);
+
+	m_hooked = hook;
+}
+
+bool CVoiceMatrix::CSGameRules_CanPlayerHearPlayer(IReGameHook_CSGameRules_CanPlayerHearPlayer *chain, CBasePlayer *pListener, CBasePlayer *pSender)
+{
+	CVoiceMatrix &self = g_voiceMatrix;
+
+	const int listener = indexOfEdict(pListener->pev);
+	const int sender = indexOfEdict(pSender->pev);
+
+	if (listener > 0 && listener <= MAX_CLIENTS && sender > 0 && sender <= MAX_CLIENTS)
+	{
+		self.Validate(listener);
+		self.Validate(sender);
+
+		const uint32 bit = 1 << (sender & 31);
+		if (self.m_decided[listener] & bit)
+			return (self.m_hear[listener] & bit) != 0;
+	}
+
+	return chain->callNext(pListener, pSender);
+}
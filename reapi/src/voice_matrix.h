@@ -0,0 +1,54 @@
+#pragma once
+
+// route of a listener and sender pair
+enum VoiceRoute
+{
+	VOICE_ROUTE_DEFAULT = 0,    // decided by the forwards and the game rules
+	VOICE_ROUTE_MUTE,           // the listener can't hear the sender
+	VOICE_ROUTE_HEAR,           // the listener can hear the sender
+};
+
+// rules of ApplyRules
+enum VoiceRule
+{
+	VOICE_RULE_ALLTALK      = 0,        // everyone hears everyone
+	VOICE_RULE_TEAM         = BIT(0),   // only the players of the same team hear each other
+	VOICE_RULE_DEAD         = BIT(1),   // the alive players don't hear the dead ones
+};
+
+// 32x32 bit matrix of who hears whom, consulted before the CSGameRules_CanPlayerHearPlayer forwards.
+// Rows are listeners, bits are senders set as 1 << (index & 31). The pairs the matrix doesn't decide
+// go through the hook chain as usual.
+class CVoiceMatrix
+{
+public:
+	CVoiceMatrix();
+
+	// listener and sender are 0 for all players
+	void Set(int listener, int sender, VoiceRoute route);
+	VoiceRoute Get(int listener, int sender);
+
+	// Bulk set of a listener, the senders outside of the decided bits keep their route
+	void SetRow(int listener, uint32 hearBits, uint32 decidedBits);
+
+	// Decides every pair of the connected players from their team and alive state
+	void ApplyRules(int rules);
+
+	// Removes the routes and unregisters the hook
+	void Clear();
+
+private:
+	static bool CSGameRules_CanPlayerHearPlayer(IReGameHook_CSGameRules_CanPlayerHearPlayer *chain, CBasePlayer *pListener, CBasePlayer *pSender);
+
+	// Drops the routes of a slot taken by another client
+	void Validate(int index);
+	void UpdateHook();
+
+	bool m_hooked = false;
+
+	uint32 m_hear[MAX_CLIENTS + 1];
+	uint32 m_decided[MAX_CLIENTS + 1];
+	int m_userid[MAX_CLIENTS + 1];
+};
+
+extern CVoiceMatrix g_voiceMatrix;